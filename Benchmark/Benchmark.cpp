@@ -0,0 +1,15 @@
+#include "pch.h"
+#include "Utils\CollisionBenchmark.h"
+
+// 창, HDC 없이 충돌 benchmark만 실행하는 console 프로그램
+// ex) Benchmark.exe scenario count=10000 frames=200 dist=cluster bp=sap > result.csv
+int wmain(int argc, wchar_t* argv[])
+{
+    std::vector<std::wstring> args(argv + 1, argv + argc);
+
+    // 아무것도 고르지 않으면 기본 scenario들을 실행
+    if (args.empty())
+        args.push_back(L"scenario");
+
+    return CollisionBenchmark::Run(args);
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+// Static Library
+#ifdef _DEBUG
+#pragma comment(lib, "Engine\\Debug\\Engine.lib")
+#else
+#pragma comment(lib, "Engine\\Release\\Engine.lib")
+#endif
+
+#include "Headers\EnginePch.h"
+
@@ -1,13 +1,28 @@
 #include "pch.h"
 #include "Engine.h"
+#include "Utils\CollisionBenchmark.h"
 
 int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
     _In_opt_ HINSTANCE hPrevInstance,
     _In_ LPWSTR    lpCmdLine,
     _In_ int       nCmdShow)
 {
+    // 창 없이 benchmark만 실행 (ex: Client.exe -benchmark narrowphase, 따로 실행하려면 Benchmark 프로젝트)
+    const std::wstring commandLine = lpCmdLine;
+    const std::vector<std::wstring> args = CollisionBenchmark::SplitArgs(commandLine);
+    if (CollisionBenchmark::HasArg(args, L"-benchmark"))
+        return CollisionBenchmark::Run(args);
+
     Engine engine;
 
+    // GDI 대신 CPU FrameBuffer로 그리기 (ex: Client.exe -software)
+    if (commandLine.find(L"-software") != std::wstring::npos)
+        engine.SetRenderBackend(RenderBackend::RB_Software);
+
+    // 바뀐 영역만 다시 그리지 않고 매 frame 전체를 다시 그리기 (ex: Client.exe -fullredraw)
+    if (commandLine.find(L"-fullredraw") != std::wstring::npos)
+        engine.SetDirtyRects(false);
+
     if (!engine.InitWin(hInstance, nCmdShow))
         return -1;
 
@@ -16,8 +16,8 @@ void Actor::Init()
 {
 	for (auto comp : _components) {
 
-		// θ Ŭ ų static_pointer_cast
-		// ڽ Ŭ Ǵ ٸ Ŭ ų dynamic_pointer_cast
+		// 부모 클래스 가르킬땐 static_pointer_cast
+		// 자식 클래스 또는 다른 클래스를 가르킬땐 dynamic_pointer_cast
 		comp->SetOwner(weak_from_this());
 		comp->Init();
 	}
@@ -29,10 +29,22 @@ void Actor::Tick(float DeltaTime)
 		comp->Tick(DeltaTime);
 }
 
-void Actor::Render(HDC hdc)
+void Actor::Render(RenderTarget& target)
 {
 	for (auto comp : _components)
-		comp->Render(hdc);
+		comp->Render(target);
+}
+
+void Actor::SetPos(const Vector2D& pos)
+{
+	if (pos == GetPos())
+		return;
+
+	Super::SetPos(pos);
+	MarkRenderDirty();
+
+	for (std::shared_ptr<Component>& component : _components)
+		component->OnMoved();
 }
 
 void Actor::AddComponent(std::shared_ptr<Component> component)
@@ -41,6 +53,7 @@ void Actor::AddComponent(std::shared_ptr<Component> component)
 		return;
 	
 	_components.push_back(std::move(component));
+	MarkRenderDirty();
 }
 
 void Actor::RemoveComponent(std::weak_ptr<Component> component)
@@ -54,6 +67,41 @@ void Actor::RemoveComponent(std::weak_ptr<Component> component)
 		return;
 
 	_components.erase(findIt);
+	MarkRenderDirty();
+}
+
+bool Actor::GetRenderBounds(RECT& bounds)
+{
+	bool found = false;
+	for (const std::shared_ptr<Component>& comp : _components) {
+		RECT compBounds;
+		if (comp->GetRenderBounds(compBounds) == false)
+			continue;
+
+		UnionRenderBounds(found, bounds, compBounds);
+		found = true;
+	}
+
+	return found;
+}
+
+RECT Actor::MakeRenderBounds(const Vector2D& center, const Vector2D& size)
+{
+	const Vector2D half = size * 0.5f;
+	return {
+		static_cast<LONG>(std::floor(center.X - half.X)) - 1,
+		static_cast<LONG>(std::floor(center.Y - half.Y)) - 1,
+		static_cast<LONG>(std::ceil(center.X + half.X)) + 1,
+		static_cast<LONG>(std::ceil(center.Y + half.Y)) + 1
+	};
+}
+
+void Actor::UnionRenderBounds(bool found, RECT& bounds, const RECT& other)
+{
+	if (found)
+		::UnionRect(&bounds, &bounds, &other);
+	else
+		bounds = other;
 }
 
 void Actor::ApplyDamage(std::weak_ptr<Actor> damagedActor, float damage, std::weak_ptr<Actor> eventInstigator, std::weak_ptr<Actor> damageCauser)
@@ -3,8 +3,8 @@
 
 class Component;
 
-// TODO: Actor Component ϴ Ŭ  ϴ° Ͱ (UE CreateDefaultSubobject ó)
-// TODO:  ׷ٸ Actor Component vectorٴ map ϴ°    
+// TODO: Actor와 Component를 생성하는 클래스를 만들어 사용하는게 좋을것같다 (UE의 CreateDefaultSubobject 처럼)
+// TODO: 만약 그렇다면 Actor와 Component들을 vector보다는 map으로 관리하는게 더 좋을수 있을것 같다
 class Actor : public Object, public std::enable_shared_from_this<Actor>
 {
 	using Super = Object;
@@ -14,17 +14,38 @@ public:
 
 	virtual void Init();
 	virtual void Tick(float DeltaTime);
-	virtual void Render(HDC hdc);
+	virtual void Render(RenderTarget& target);
+
+	// 위치가 바뀌면 Component들에게도 알려준다. (ex: 잠든 Collider 깨우기)
+	virtual void SetPos(const Vector2D& pos) override;
 
 	void AddComponent(std::shared_ptr<Component> component);
 	void RemoveComponent(std::weak_ptr<Component> component);
 
-	// TODO: Damage  Լ
+	/*
+		그리는 영역 (World 좌표, Level은 카메라 밖에 있는 Actor의 Render를 호출하지 않는다)
+			- 기본은 Component(debug 도형 등)가 그리는 영역을 합친 것
+			- false = 영역을 알 수 없다. (항상 그린다, 화면 좌표로 그리는 UI 등)
+	*/
+	virtual bool GetRenderBounds(RECT& bounds);
+	// 위치나 그리는 크기가 바뀌면 호출 (Level은 값이 바뀐 Actor만 영역을 다시 구한다)
+	void MarkRenderDirty() { ++_renderVersion; }
+	uint32 GetRenderVersion() const { return _renderVersion; }
+
+	// TODO: Damage 관련 함수
 	// https://erikanes.tistory.com/352
 	// https://mingyu0403.tistory.com/258
-	// parameter:   , ,   (÷̾ ),    (Ѿ, Į ),
+	// parameter: 데미지를 입은 액터, 데미지, 데미지를 준 액터(플레이어 등), 데미지를 준 실직적 액터(총알, 칼 등),
 	void ApplyDamage(std::weak_ptr<Actor> damagedActor, float damage, std::weak_ptr<Actor> eventInstigator, std::weak_ptr<Actor> damageCauser);
 	virtual float TakeDamage(float damageAmount, std::weak_ptr<Actor> eventInstigator, std::weak_ptr<Actor> damageCauser);
+
+protected:
+	// center를 중심으로 size 크기 (걸치는 pixel과 화면 좌표로 바꿀때의 반올림 차이까지 포함)
+	static RECT MakeRenderBounds(const Vector2D& center, const Vector2D& size);
+	// Super::GetRenderBounds의 결과(found, bounds)에 other를 합친다.
+	static void UnionRenderBounds(bool found, RECT& bounds, const RECT& other);
+
 private:
 	std::vector<std::shared_ptr<Component>> _components;
+	uint32 _renderVersion = 1;
 };
@@ -1,8 +1,8 @@
 #include "pch.h"
 #include "Enemy.h"
 #include "Component\SquareComponent.h"
-#include "Component\CircleComponent.h"
 #include "Manager\AssetManager.h"
+#include "Manager\CollisionManager.h"
 #include "Resources\Flipbook.h"
 #include "Resources\Tilemap.h"
 #include "Actor\TilemapActor.h"
@@ -14,12 +14,6 @@ Enemy::Enemy() {
 
 	Set2DAnimation();
 
-	_circle = std::make_shared<CircleComponent>();
-	_circle->SetCollisionLayer(CLT_Trace);
-	_circle->SetCollisionFlag(CLT_Object);
-	_circle->SetRadius(70.f);
-	AddComponent(_circle);
-
 	SetMaxSpeed(60.f);
 }
 
@@ -28,14 +22,14 @@ Enemy::~Enemy() {}
 void Enemy::Init()
 {
 	Super::Init();
-
-	_circle->_endOverlapDelegate.BindDelegate(this, &Enemy::EndAttackRange);
 }
 
 void Enemy::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	TickAttackRange();
+
 	switch (GetState())
 	{
 	case ActionState::AS_Idle:
@@ -50,15 +44,29 @@ void Enemy::Tick(float DeltaTime)
 	}
 }
 
-void Enemy::Render(HDC hdc)
+void Enemy::Render(RenderTarget& target)
 {
-	Super::Render(hdc);
+	Super::Render(target);
 }
 
 
-void Enemy::EndAttackRange(std::weak_ptr<Collider> comp, std::weak_ptr<Actor> other, std::weak_ptr<Collider> otherComp)
+void Enemy::TickAttackRange()
 {
-	Chase();
+	// 범위용 Collider를 계속 두지 않고 매 Tick 한번 Query로 찾는다.
+	_queryResults.clear();
+	GET_SINGLE(CollisionManager)->OverlapCircle(GetPos(), _attackRange, CLT_Object, _queryResults, this);
+
+	// 결과는 등록된 순서(= id 순서)
+	_queryIds.clear();
+	for (const std::shared_ptr<Collider>& collider : _queryResults)
+		_queryIds.push_back(collider->GetCollisionId());
+	_queryResults.clear();
+
+	const bool someoneLeft = std::includes(_queryIds.begin(), _queryIds.end(), _inRangeIds.begin(), _inRangeIds.end()) == false;
+	_inRangeIds.swap(_queryIds);
+
+	if (someoneLeft)
+		Chase();
 }
 
 
@@ -96,13 +104,13 @@ void Enemy::Move(float DeltaTime)
 {
 	Vector2D dir = (GetDestPos() - GetPos());
 	float dist = dir.Length();
-	if (dir.Length() < 5.f) //   
+	if (dir.Length() < 5.f) // 도착지점에 충분히 가까우면
 	{
 		SetPos(GetDestPos());
 		SetSpeed(0.f);
 		SetState(ActionState::AS_Idle);
 	}
-	//  ε巴 ̵ 
+	// 도착지까지 부드럽게 움직이도록 보정
 	else {
 		bool horizontal = std::abs(dir.X) > abs(dir.Y);
 		if (horizontal)
@@ -129,7 +137,7 @@ void Enemy::Chase()
 	if (target) {
 		Vector2D dir = target->GetPos() - GetPos();
 		float dist = std::abs(dir.X) + std::abs(dir.Y);
-		if (dist < 80.f) // ٷ ̶
+		if (dist < 80.f) // 바로 앞이라면
 		{
 			SetDir(GetLookAtDir(target->GetPos()));
 			SetWaitSeconds(GetMaxWaitSeconds());
@@ -137,13 +145,13 @@ void Enemy::Chase()
 		}
 		else 
 		{
-			// ǥ  ã 1ĭ ̵ϰ ٽ ã  ݺ
-			// (귮 δ ǳ  ڿ. δǸ  ð ã )
+			// 목표까지 길을 찾고 1칸 이동하고 다시 찾는 걸 반복
+			// (계산량에 부담은 되나 더 자연스럽다. 부담되면 일정 시간에 찾도록 변경)
 			std::vector<Vector2D> path;
 			Vector2D targetCellPos = tmActor->ConvertToTilemapPos(target->GetPos());
 			AlgorithmUtils::FindPathAStar(GetCellPos(), targetCellPos, OUT path);
 			{
-				// index 0  ġ
+				// index 0은 현재 위치
 				if (path.size() > 1)
 				{
 					Vector2D nextPos = path[1];
@@ -168,10 +176,9 @@ void Enemy::Attack(float DeltaTime)
 	if (_waitSeconds > 0)
 	{
 		SetWaitSeconds(max(0, _waitSeconds - DeltaTime));
-		_attackZone->SetCollisionDisable();
 		return;
 	}
 
-	_attackZone->SetCollisionEnable();
+	AttackTrace();
 	SetState(ActionState::AS_Idle);
 }
\ No newline at end of file
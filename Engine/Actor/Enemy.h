@@ -1,7 +1,6 @@
 #pragma once
 #include "GameActor.h"
 
-class CircleComponent;
 class Collider;
 
 class Enemy : public GameActor
@@ -10,9 +9,7 @@ class Enemy : public GameActor
 public:
 	virtual void Init() override;
 	virtual void Tick(float DeltaTime) override;
-	virtual void Render(HDC hdc) override;
-
-	void EndAttackRange(std::weak_ptr<Collider> comp, std::weak_ptr<Actor> other, std::weak_ptr<Collider> otherComp);
+	virtual void Render(RenderTarget& target) override;
 
 protected:
 	virtual void Set2DAnimation() override;
@@ -22,6 +19,8 @@ protected:
 
 private:
 	void Chase();
+	// 공격 범위 안에 있던 Object가 범위를 벗어나면 다시 쫓아간다.
+	void TickAttackRange();
 
 public:
 	void SetWaitSeconds(float seconds) { _waitSeconds = seconds; }
@@ -31,7 +30,11 @@ public:
 	float GetMaxWaitSeconds() const { return _maxWaitSeconds; }
 
 private:
-	std::shared_ptr<CircleComponent> _circle;
+	float _attackRange = 70.f;
+	// 지난 Tick 공격 범위 안에 있던 Collider id (정렬된 상태)
+	std::vector<uint32> _inRangeIds;
+	std::vector<uint32> _queryIds;
+	std::vector<std::shared_ptr<Collider>> _queryResults;
 
 	float _waitSeconds = 0.f;
 	float _maxWaitSeconds = 1.f;
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "FlipbookActor.h"
 #include "Resources\Flipbook.h"
+#include "Render\RenderTarget.h"
 #include "World\World.h"
 #include "Engine.h"
 
@@ -29,10 +30,10 @@ void FlipbookActor::Tick(float DeltaTime)
 
 	_sumTime += DeltaTime;
 
-	// Sprite Animation Play Time
+	// Sprite Animation이 Play될 Time
 	const FlipbookInfo& info = _flipbook->GetInfo();
-	int32 frameCount = (info.end - info.start + 1); // Animation Sprite 
-	float delta = info.duration / frameCount; // Animaiont  play ð / Animation Sprite 
+	int32 frameCount = (info.end - info.start + 1); // Animation Sprite 수
+	float delta = info.duration / frameCount; // Animaiont 총 play 시간 / Animation Sprite 수
 
 	if (_sumTime >= delta)
 	{
@@ -45,48 +46,59 @@ void FlipbookActor::Tick(float DeltaTime)
 }
 
 
-void FlipbookActor::Render(HDC hdc)
+void FlipbookActor::Render(RenderTarget& target)
 {
-	Super::Render(hdc);
+	Super::Render(target);
 
 	if (_flipbook == nullptr)
 		return;
 
 	const FlipbookInfo& info = _flipbook->GetInfo();
+	const std::vector<FlipbookFrame>& frames = _flipbook->GetFrames();
+	if (_idx >= static_cast<int32>(frames.size()) || frames[_idx].width == 0)
+		return;
 
 	Vector2D pos = GetPos();
 	Vector2D size = info.spriteSize;
 	Vector2D cameraPos = World::GetCameraPos();
-	// TransparentBlt »ܺ ׸µ ǥ ߾ ǵ 
+	// RenderTarget은 좌상단부터 그리는데 좌표가 중앙이 되도록 보정
 	pos = pos - size * 0.5f - (cameraPos - Engine::GetScreenSize() * 0.5f);
 
-
-	::TransparentBlt(hdc,
-		// ̹  ġ 
-		static_cast<int32>(pos.X),
-		static_cast<int32>(pos.Y),
-		//  ̹ ũ
-		static_cast<int32>(size.X),
-		static_cast<int32>(size.Y),
-		// ̹ ڵ
-		info.texture->GetDC(),
-		// ̹  ̹ 
-		static_cast<int32>((info.start + _idx) * size.X),
-		static_cast<int32>(info.line * size.Y),
-		//  ̹ ũ
-		static_cast<int32>(size.X),
-		static_cast<int32>(size.Y),
-		info.texture->GetTransparent()
+	// frame에서 투명한 부분을 잘라낸 영역만 opacity로 그린다. (잘라낸 만큼 위치 보정)
+	const FlipbookFrame& frame = frames[_idx];
+	target.BlitAlpha(
+		// 이미지 출력 위치 
+		static_cast<int32>(pos.X) + frame.offsetX,
+		static_cast<int32>(pos.Y) + frame.offsetY,
+		// 출력할 이미지의 크기
+		frame.width,
+		frame.height,
+		*info.texture,
+		// 이미지에서 가져올 이미지의 시작지점
+		frame.srcX,
+		frame.srcY,
+		_opacity
 	);
 }
 
+bool FlipbookActor::GetRenderBounds(RECT& bounds)
+{
+	bool found = Super::GetRenderBounds(bounds);
+	if (_flipbook == nullptr)
+		return found;
+
+	// frame마다 잘라낸 영역은 달라도 spriteSize 안에 있다.
+	UnionRenderBounds(found, bounds, MakeRenderBounds(GetPos(), _flipbook->GetInfo().spriteSize));
+	return true;
+}
+
 bool FlipbookActor::IsAnimationStarted()
 {
 	if (_flipbook == nullptr)
 		return true;
 
 	const FlipbookInfo& info = _flipbook->GetInfo();
-	// Loop   sprite play
+	// Loop가 없고 모든 sprite를 play했으면
 	if (info.loop == false && _idx == info.start)
 		return true;
 
@@ -99,7 +111,7 @@ bool FlipbookActor::IsAnimationAtIdx(int32 index)
 		return true;
 
 	const FlipbookInfo& info = _flipbook->GetInfo();
-	// Loop   sprite play
+	// Loop가 없고 모든 sprite를 play했으면
 	if (info.loop == false && _idx == index)
 		return true;
 
@@ -112,7 +124,7 @@ bool FlipbookActor::IsAnimationEnded()
 		return true;
 
 	const FlipbookInfo& info = _flipbook->GetInfo();
-	// Loop   sprite play
+	// Loop가 없고 모든 sprite를 play했으면
 	if (info.loop == false && _idx == info.end)
 		return true;
 
@@ -126,11 +138,13 @@ void FlipbookActor::SetFlipbook(std::shared_ptr<Flipbook> flipbook)
 
 	_flipbook = flipbook;
 	Reset();
+	MarkRenderDirty();
 }
 
 void FlipbookActor::SetInfo(const FlipbookInfo& info)
 {
 	_flipbook->SetInfo(info);
+	MarkRenderDirty();
 }
 
 
@@ -9,13 +9,14 @@ public:
 
 	virtual void Init() override;
 	virtual void Tick(float DeltaTime) override;
-	virtual void Render(HDC hdc) override;
+	virtual void Render(RenderTarget& target) override;
+	virtual bool GetRenderBounds(RECT& bounds) override;
 
 	bool IsAnimationStarted();
 	bool IsAnimationAtIdx(int32 index);
-	// Animation  Ȯ
+	// Animation이 끝날걸 확인
 	bool IsAnimationEnded();
-	// TODO:  ð  Animation Ȱɷ Ǵ  ִ.
+	// TODO: 일정 시간이 지나면 Animation이 종료된걸로 판단할 수도 있다.
 	// bool IsAnimationEnded(float time);
 public:
 	void SetFlipbook(std::shared_ptr<Flipbook> flipbook);
@@ -24,9 +25,14 @@ public:
 	void SetInfo(const struct FlipbookInfo& info);
 	void Reset();
 
+	// 0 = 보이지 않음 ~ 255 = 불투명 (texture의 alpha에 곱한다)
+	void SetOpacity(uint8 opacity) { _opacity = opacity; }
+	uint8 GetOpacity() const { return _opacity; }
+
 protected:
 	float _sumTime = 0.f;
 	int32 _idx = 0;
+	uint8 _opacity = 255;
 
 private:
 	std::shared_ptr<Flipbook> _flipbook;
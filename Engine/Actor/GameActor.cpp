@@ -4,6 +4,7 @@
 #include "SpriteEffect.h"
 #include "Resources\Flipbook.h"
 #include "Manager\AssetManager.h"
+#include "Manager\CollisionManager.h"
 #include "Actor\TilemapActor.h"
 #include "World\World.h"
 #include "World\Level.h"
@@ -16,14 +17,6 @@ GameActor::GameActor() {
 	_actor->SetSize({ 50.f, 50.f });
 	AddComponent(_actor);
 
-	_attackZone = CreateSubobject<SquareComponent>(L"AttackZone");
-	_attackZone->SetSize({ 25.f, 25.f });
-	_attackZone->AddLocalPos(GetDirVector2D(GetDir()) * 50.f);
-	_attackZone->SetCollisionLayer(CLT_Trace);
-	_attackZone->SetCollisionFlag(CLT_Object);
-	_attackZone->SetCollisionDisable();
-	AddComponent(_attackZone);
-
 	// Effect 
 	if (std::shared_ptr<Texture> texture = GET_SINGLE(AssetManager)->GetTexture(L"HitEffect"))
 	{
@@ -40,7 +33,6 @@ void GameActor::Init()
 	Super::Init();
 
 	_actor->_beginOverlapDelegate.BindDelegate(this, &GameActor::BeginOverlapFunction);
-	_attackZone->_beginOverlapDelegate.BindDelegate(this, &GameActor::BeginAttackZone);
 }
 
 void GameActor::Tick(float DeltaTime)
@@ -48,9 +40,9 @@ void GameActor::Tick(float DeltaTime)
 	Super::Tick(DeltaTime);
 }
 
-void GameActor::Render(HDC hdc)
+void GameActor::Render(RenderTarget& target)
 {
-	Super::Render(hdc);
+	Super::Render(target);
 }
 
 void GameActor::BeginOverlapFunction(std::weak_ptr<Collider> comp, std::weak_ptr<Actor> other, std::weak_ptr<Collider> otherComp)
@@ -60,17 +52,27 @@ void GameActor::BeginOverlapFunction(std::weak_ptr<Collider> comp, std::weak_ptr
 		SetPos(GetPos() - collider->GetIntersect());
 }
 
-void GameActor::BeginAttackZone(std::weak_ptr<Collider> comp, std::weak_ptr<Actor> other, std::weak_ptr<Collider> otherComp)
+void GameActor::AttackTrace()
 {
-	//  weapon actor ϸ damageCauser parameter  
-	ApplyDamage(other, _stat.attack, weak_from_this(), weak_from_this());
-
-	std::shared_ptr<Level> level = World::GetCurrentLevel();
-	if (level == nullptr)
-		return;
+	// 공격 범위 Collider를 계속 켜두지 않고 공격하는 순간에만 Query로 찾는다.
+	const Vector2D center = GetPos() + GetDirVector2D(GetDir()) * 50.f;
+	std::vector<std::shared_ptr<Collider>> targets;
+	GET_SINGLE(CollisionManager)->OverlapBox(center, { 12.5f, 12.5f }, CLT_Object, targets, this);
+
+	// Collider가 여러개인 Actor도 한번만
+	std::vector<Actor*> damagedActors;
+	for (const std::shared_ptr<Collider>& target : targets) {
+		std::shared_ptr<Actor> other = target->GetOwner();
+		if (other == nullptr || std::find(damagedActors.begin(), damagedActors.end(), other.get()) != damagedActors.end())
+			continue;
+		damagedActors.push_back(other.get());
+
+		// 따로 weapon actor를 사용하면 damageCauser parameter는 무기 액터
+		ApplyDamage(other, _stat.attack, weak_from_this(), weak_from_this());
 
-	if (_hitEffect) {
-		_hitEffect = level->SpawnObject<SpriteEffect>(_hitEffect, GetPos() + GetDirVector2D(GetDir()) * 50.f);
+		std::shared_ptr<Level> level = World::GetCurrentLevel();
+		if (level && _hitEffect)
+			_hitEffect = level->SpawnObject<SpriteEffect>(_hitEffect, center);
 	}
 }
 
@@ -125,8 +127,8 @@ Dir GameActor::GetLookAtDir(Vector2D pos)
 
 Vector2D GameActor::GetDirVector2D(Dir dir)
 {
-	// enum Dir  ش. (¿)
-	static Vector2D nextDir[4] = { {0, -1}, {0, 1}, {-1, 0}, {1, 0} }; //  
+	// enum Dir과 순서를 맞춰준다. (상하좌우)
+	static Vector2D nextDir[4] = { {0, -1}, {0, 1}, {-1, 0}, {1, 0} }; // 다음 방향
 	return nextDir[dir];
 }
 
@@ -137,8 +139,7 @@ void GameActor::SetDir(Dir dir)
 
 	_dir = dir;
 
-	_attackZone->AddLocalPos(GetDirVector2D(_dir) * 50.f);
-	//  ٲ Animation ¿ ° ٲش.
+	// 방향이 바뀌면 Animation도 상태에 맞게 바꿔준다.
 	UpdateAnimation();
 }
 
@@ -148,7 +149,7 @@ void GameActor::SetState(ActionState state)
 		return;
 
 	_state = state;
-	// ° ٲ Animation ¿ ° ٲش.
+	// 상태가 바뀌면 Animation도 상태에 맞게 바꿔준다.
 	UpdateAnimation();
 }
 
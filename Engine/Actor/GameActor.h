@@ -12,10 +12,9 @@ class GameActor : public FlipbookActor
 public:
 	virtual void Init() override;
 	virtual void Tick(float DeltaTime) override;
-	virtual void Render(HDC hdc) override;
+	virtual void Render(RenderTarget& target) override;
 
 	void BeginOverlapFunction(std::weak_ptr<Collider> comp, std::weak_ptr<Actor> other, std::weak_ptr<Collider> otherComp);
-	void BeginAttackZone(std::weak_ptr<Collider> comp, std::weak_ptr<Actor> other, std::weak_ptr<Collider> otherComp);
 
 	virtual float TakeDamage(float damageAmount, std::weak_ptr<Actor> eventInstigator, std::weak_ptr<Actor> damageCauser) override;
 
@@ -23,6 +22,8 @@ protected:
 	virtual void Set2DAnimation();
 	virtual void UpdateAnimation() {}
 	virtual void Attack(float DeltaTime);
+	// 바라보는 방향 앞의 공격 범위를 한번 검사해 데미지를 준다.
+	void AttackTrace();
 	virtual void GetDamage(float damage);
 	
 	virtual Dir GetLookAtDir(Vector2D pos);
@@ -53,7 +54,6 @@ protected:
 	ActionState _state = ActionState::AS_Attack;
 
 	std::shared_ptr<SquareComponent> _actor;
-	std::shared_ptr<SquareComponent> _attackZone;
 
 	std::array<std::shared_ptr<Flipbook>, 4> _idle;
 	std::array<std::shared_ptr<Flipbook>, 4> _move;
@@ -5,7 +5,7 @@
 #include "Resources\Flipbook.h"
 #include "Resources\Tilemap.h"
 #include "Manager\AssetManager.h"
-#include "Manager\InputManager.h" // TODO: managerٴ InputComponent   
+#include "Manager\InputManager.h" // TODO: manager보다는 InputComponent가 더 좋을것 같다
 #include "Actor\TilemapActor.h"
 #include "World\Level.h"
 #include "World\World.h"
@@ -42,9 +42,9 @@ void Player::Tick(float DeltaTime)
 	
 }
 
-void Player::Render(HDC hdc)
+void Player::Render(RenderTarget& target)
 {
-	Super::Render(hdc); // Flipbook Actor  _flipbook 
+	Super::Render(target); // Flipbook Actor에서 설정된 _flipbook을 렌더링
 }
 
 void Player::UpdateAnimation()
@@ -69,12 +69,13 @@ void Player::Attack(float DeltaTime)
 {
 	Super::Attack(DeltaTime);
 
-	if (IsAnimationStarted())
-		_attackZone->SetCollisionEnable();
-	else
-		_attackZone->SetCollisionDisable();
+	// 공격 Animation이 시작될때 한번만 공격 범위 검사
+	if (IsAnimationStarted() && _attackTraced == false) {
+		_attackTraced = true;
+		AttackTrace();
+	}
 
-	// ִϸ̼    
+	// 애니메이션이 끝나면 다음 공격 가능
 	if (IsAnimationEnded()) {
 		SetState(ActionState::AS_Idle);
 	}
@@ -167,8 +168,10 @@ void Player::PlayerInput()
 	else 
 		SetSpeed(0.f);
 	
-	if (GET_SINGLE(InputManager)->GetEventPressed(KeyType::SpaceBar)) 
+	if (GET_SINGLE(InputManager)->GetEventPressed(KeyType::SpaceBar)) {
+		_attackTraced = false;
 		SetState(ActionState::AS_Attack);
+	}
 }
 
 void Player::Move(float DeltaTime)
@@ -176,12 +179,15 @@ void Player::Move(float DeltaTime)
 	if (GetState() == ActionState::AS_Attack)
 		return;
 
-	//  ũ⸸ŭ 
-	std::shared_ptr<Tilemap> tilemap = Level::GetCurTilemap();
-	Vector2D cellPos = GetPos() + GetDirVector2D(GetDir()) * (GetSize() * 0.5f);
-	Vector2D toTilemapPos = Level::GetCurrentTilemapActor()->ConvertToTilemapPos(cellPos);
-	if (tilemap && tilemap->CanGo(toTilemapPos) == false) {
-		SetSpeed(0.f);
+	Vector2D move = GetDirVector2D(GetDir()) * GetSpeed() * DeltaTime;
+
+	// 액터 크기의 사각형으로 이동 경로를 검사해 벽 바로 앞까지만 이동
+	std::shared_ptr<TilemapActor> tmActor = Level::GetCurrentTilemapActor();
+	if (tmActor) {
+		const TileSweepResult result = tmActor->SweepBox(GetPos(), GetSize() * 0.5f, move);
+		move = result.move;
+		if (result.blocked && result.time <= 0.f)
+			SetSpeed(0.f);
 	}
 
 	if (GetSpeed() == 0.f)
@@ -189,7 +195,7 @@ void Player::Move(float DeltaTime)
 	else
 		SetState(ActionState::AS_Move);
 
-	SetPos(GetPos() + GetDirVector2D(GetDir()) * GetSpeed() * DeltaTime);
+	SetPos(GetPos() + move);
 }
 
 
@@ -3,14 +3,14 @@
 
 class CameraComponent;
 
-// TODO : Input Animation Component  °   
+// TODO : Input과 Animation을 Component로 따로 만드는게 더 좋지 않을까
 class Player : public GameActor
 {
 	GENERATE_BODY(Player, GameActor)
 public:
 	virtual void Init() override;
 	virtual void Tick(float DeltaTime) override;
-	virtual void Render(HDC hdc) override;
+	virtual void Render(RenderTarget& target) override;
 
 protected:
 	virtual void Set2DAnimation() override;
@@ -23,5 +23,8 @@ private:
 
 private:
 	std::shared_ptr<CameraComponent> _camera;
+
+	// 이번 공격에서 이미 공격 범위를 검사했는지
+	bool _attackTraced = false;
 };
 
@@ -2,6 +2,7 @@
 #include "SpriteActor.h"
 #include "Manager\AssetManager.h"
 #include "Resources\Sprite.h"
+#include "Render\RenderTarget.h"
 #include "World\World.h"
 #include "Engine.h"
 
@@ -32,9 +33,9 @@ void SpriteActor::Tick(float DeltaTime)
 	
 }
 
-void SpriteActor::Render(HDC hdc)
+void SpriteActor::Render(RenderTarget& target)
 {
-	Super::Render(hdc);
+	Super::Render(target);
 
 	if (_sprite == nullptr)
 		return;
@@ -42,33 +43,39 @@ void SpriteActor::Render(HDC hdc)
 	Vector2D pos = GetPos();
 	Vector2D size = _sprite->GetSpriteSize();
 	Vector2D cameraPos = World::GetCameraPos();
-	// TransparentBlt »ܺ ׸µ ǥ ߾ ǵ 
+	// RenderTarget은 좌상단부터 그리는데 좌표가 중앙이 되도록 보정
 	pos = pos - size * 0.5f - (cameraPos - Engine::GetScreenSize() * 0.5f);
 
-	::TransparentBlt(hdc,
-		// ̹  ġ 
+	target.BlitColorKey(
+		// 이미지 출력 위치 
 		static_cast<int32>(pos.X),
 		static_cast<int32>(pos.Y),
-		//  ̹ ũ
+		// 출력할 이미지의 크기
 		static_cast<int32>(size.X),
 		static_cast<int32>(size.Y),
-		// ̹ ڵ
-		_sprite->GetDC(),
-		// ̹  ̹ 
+		*_sprite->GetTexture(),
+		// 이미지에서 가져올 이미지의 시작지점
 		static_cast<int32>(_sprite->GetSpritePos().X),
-		static_cast<int32>(_sprite->GetSpritePos().Y),
-		//  ̹ ũ
-		static_cast<int32>(size.X),
-		static_cast<int32>(size.Y),
-		_sprite->GetTransparent()
+		static_cast<int32>(_sprite->GetSpritePos().Y)
 	);
 }
 
+bool SpriteActor::GetRenderBounds(RECT& bounds)
+{
+	bool found = Super::GetRenderBounds(bounds);
+	if (_sprite == nullptr)
+		return found;
+
+	UnionRenderBounds(found, bounds, MakeRenderBounds(GetPos(), _sprite->GetSpriteSize()));
+	return true;
+}
+
 void SpriteActor::SetSprite(std::shared_ptr<Sprite> sprite)
 { 
 	if (!sprite || _sprite == sprite)
 		return;
 
 	_sprite = sprite;
+	MarkRenderDirty();
 }
 
@@ -10,7 +10,8 @@ public:
 
 	virtual void Init() override;
 	virtual void Tick(float DeltaTime) override;
-	virtual void Render(HDC hdc) override;
+	virtual void Render(RenderTarget& target) override;
+	virtual bool GetRenderBounds(RECT& bounds) override;
 
 public:
 	void SetSprite(std::shared_ptr<Sprite> sprite);
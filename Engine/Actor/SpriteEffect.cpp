@@ -25,6 +25,15 @@ void SpriteEffect::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	// 마지막 frame으로 갈수록 흐려진다.
+	if (std::shared_ptr<Flipbook> flipbook = GetFlipbook()) {
+		const FlipbookInfo& info = flipbook->GetInfo();
+		const int32 lastIdx = max(1, info.end - info.start);
+		const float frameTime = info.duration / (info.end - info.start + 1);
+		const float progress = (_idx + (frameTime > 0.f ? _sumTime / frameTime : 0.f)) / lastIdx;
+		SetOpacity(static_cast<uint8>(255.f * (1.f - std::clamp(progress, 0.f, 1.f))));
+	}
+
  	if (IsAnimationEnded()) {
 		std::shared_ptr<Level> level = World::GetCurrentLevel();
 		if (level)
@@ -33,9 +42,9 @@ void SpriteEffect::Tick(float DeltaTime)
 	}
 }
 
-void SpriteEffect::Render(HDC hdc)
+void SpriteEffect::Render(RenderTarget& target)
 {
-	Super::Render(hdc);
+	Super::Render(target);
 }
 
 void SpriteEffect::UpdateAnimation()
@@ -9,7 +9,7 @@ class SpriteEffect : public FlipbookActor
 public:
 	virtual void Init() override;
 	virtual void Tick(float DeltaTime) override;
-	virtual void Render(HDC hdc) override;
+	virtual void Render(RenderTarget& target) override;
 
 	void UpdateAnimation();
 };
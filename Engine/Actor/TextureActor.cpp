@@ -2,6 +2,7 @@
 #include "TextureActor.h"
 #include "Manager\AssetManager.h"
 #include "Resources\Texture.h"
+#include "Render\RenderTarget.h"
 #include "Utils\WinUtils.h"
 
 TextureActor::TextureActor()
@@ -26,9 +27,9 @@ void TextureActor::Tick(float DeltaTime)
 
 }
 
-void TextureActor::Render(HDC hdc)
+void TextureActor::Render(RenderTarget& target)
 {
-	Super::Render(hdc);
+	Super::Render(target);
 
 	if (_texture == nullptr)
 		return;
@@ -36,25 +37,10 @@ void TextureActor::Render(HDC hdc)
 	Vector2D pos = GetPos();
 	Vector2D size = _texture->GetSize();
 
-	// TransparentBlt »ܺ ׸µ ǥ ߾ ǵ 
+	// RenderTarget은 좌상단부터 그리는데 좌표가 중앙이 되도록 보정
 	pos -= size * 0.5f;
 
-	::TransparentBlt(hdc,
-		// ̹  ġ 
-		(int32)pos.X,
-		(int32)pos.Y,
-		//  ̹ ũ
-		(int32)size.X,
-		(int32)size.Y,
-		// ̹ ڵ
-		_texture->GetDC(),
-		// ̹  ̹ 
-		0,
-		0,
-		//  ̹ ũ
-		(int32)size.X,
-		(int32)size.Y,
-		_texture->GetTransparent());
+	target.BlitColorKey((int32)pos.X, (int32)pos.Y, (int32)size.X, (int32)size.Y, *_texture, 0, 0);
 }
 
 void TextureActor::SetTexutre(std::shared_ptr<Texture> texture)
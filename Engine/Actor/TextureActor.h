@@ -10,7 +10,9 @@ public:
 
 	virtual void Init() override;
 	virtual void Tick(float DeltaTime) override;
-	virtual void Render(HDC hdc) override;
+	virtual void Render(RenderTarget& target) override;
+	// 화면 좌표로 그리므로 culling하지 않는다.
+	virtual bool GetRenderBounds(RECT& bounds) override { return false; }
 
 	void SetTexutre(std::shared_ptr<Texture> texture);
 
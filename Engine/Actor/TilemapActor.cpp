@@ -4,13 +4,15 @@
 #include "Manager\AssetManager.h"
 #include "Manager\InputManager.h"
 #include "Resources\Sprite.h"
+#include "Render\RenderTarget.h"
+#include "Resources\Texture.h"
 #include "Engine.h"
 #include "World\World.h"
 
 TilemapActor::TilemapActor()
 {
 	_tilemap = GET_SINGLE(AssetManager)->CreateTilemap(L"Tilemap_Basic");
-	_tilemap->SetMapSize({ 63, 43 }); // Mapsize / tilesize =>  tile (mapsize.X * mapsize.Y)
+	_tilemap->SetMapSize({ 63, 43 }); // Mapsize / tilesize => 맵의 tile 개수(mapsize.X * mapsize.Y)
 	_tilemap->SetTileSize(48);
 	GET_SINGLE(AssetManager)->LoadTilemap(L"Tilemap_Basic", L"Tilemap\\Tilemap_basic_FINAL.txt");
 
@@ -40,6 +42,12 @@ void TilemapActor::Tick(float DeltaTime)
 	
 	TickPicking();
 
+	// 카메라 밖이면 Render(UpdateChunks)가 불리지 않으므로 여기서 확인
+	if (_tilemap && _boundsRevision != _tilemap->GetRevision()) {
+		_boundsRevision = _tilemap->GetRevision();
+		MarkRenderDirty();
+	}
+
 	if (GET_SINGLE(InputManager)->GetEventDown(KeyType::P)) {
 		GET_SINGLE(AssetManager)->SaveTilemap(L"Tilemap_Basic", L"Tilemap\\Tilemap_basic_FINAL.txt");
 	}
@@ -48,89 +56,170 @@ void TilemapActor::Tick(float DeltaTime)
 	}
 }
 
-void TilemapActor::Render(HDC hdc)
+void TilemapActor::Render(RenderTarget& target)
 {
-	Super::Render(hdc);
+	Super::Render(target);
 
 	if (_tilemap == nullptr || _showDebug == false)
 		return;
 
-	const Vector2D mapSize = _tilemap->GetMapSize();
+	UpdateChunks();
 
-	std::vector<std::vector<Tile>>& tiles = _tilemap->GetTiles();
-
-	// Culling : ̴ κи 
+	// Culling : 보이는 chunk만 렌더링 (tile 하나씩이 아니라 chunk 하나를 한번에 그린다)
 	const Vector2D halfScreenSize = Engine::GetScreenSize() * 0.5f;
 	const Vector2D cameraPos = World::GetCameraPos();
-	const Vector2D tileSize = { 1 / (float)TILE_SIZEX, 1 / (float)TILE_SIZEY };
+	const Vector2D chunkSize = { 1 / (float)(TILE_SIZEX * TILE_CHUNK), 1 / (float)(TILE_SIZEY * TILE_CHUNK) };
 	Vector2D pos = GetPos();
 
-	//  κ
-	Vector2D start = (cameraPos - halfScreenSize - pos) * tileSize;
-	Vector2D end = (cameraPos + halfScreenSize - pos) * tileSize;
+	// 보여야할 부분
+	Vector2D start = MathUtils::floor((cameraPos - halfScreenSize - pos) * chunkSize);
+	Vector2D end = MathUtils::floor((cameraPos + halfScreenSize - pos) * chunkSize);
 
 	pos = pos - (cameraPos - halfScreenSize);
-	for (int32 y = (int32)start.Y; y <= (int32)end.Y; ++y) {
-		for (int32 x = (int32)start.X; x <= (int32)end.X; ++x) {
-			if (x < 0 || x >= (int32)mapSize.X || y < 0 || y >= (int32)mapSize.Y)
+	for (int32 y = max((int32)start.Y, 0); y <= min((int32)end.Y, _chunkCountY - 1); ++y) {
+		for (int32 x = max((int32)start.X, 0); x <= min((int32)end.X, _chunkCountX - 1); ++x) {
+			TilemapChunk& chunk = _chunks[y * _chunkCountX + x];
+			if (chunk.dirty)
+				BakeChunk(x, y);
+
+			if (chunk.texture == nullptr)
 				continue;
-		
-			//   𼭸 
-			switch (tiles[y][x].value) {
-			case 0:
-			{
-				::TransparentBlt(hdc,
-					static_cast<int32>(pos.X + x * TILE_SIZEX),
-					static_cast<int32>(pos.Y + y * TILE_SIZEY),
-					TILE_SIZEX,
-					TILE_SIZEY,
-					_spriteO->GetDC(),
-					static_cast<int32>(_spriteO->GetSpritePos().X),
-					static_cast<int32>(_spriteO->GetSpritePos().Y),
-					TILE_SIZEX,
-					TILE_SIZEY,
-					_spriteO->GetTransparent());
-			}
-				break;
-			case 1:
-			{
-				::TransparentBlt(hdc,
-					static_cast<int32>(pos.X + x * TILE_SIZEX),
-					static_cast<int32>(pos.Y + y * TILE_SIZEY),
-					TILE_SIZEX,
-					TILE_SIZEY,
-					_spriteX->GetDC(),
-					(int32)_spriteX->GetSpritePos().X,
-					(int32)_spriteX->GetSpritePos().Y,
-					TILE_SIZEX,
-					TILE_SIZEY,
-					_spriteX->GetTransparent());
-			}
-				break;
+
+			// 왼쪽 상단 모서리 기준
+			target.BlitColorKey(
+				static_cast<int32>(pos.X + x * TILE_SIZEX * TILE_CHUNK),
+				static_cast<int32>(pos.Y + y * TILE_SIZEY * TILE_CHUNK),
+				chunk.texture->GetWidth(),
+				chunk.texture->GetHeight(),
+				*chunk.texture,
+				0,
+				0);
+		}
+	}
+
+}
+
+bool TilemapActor::GetRenderBounds(RECT& bounds)
+{
+	bool found = Super::GetRenderBounds(bounds);
+	if (_tilemap == nullptr)
+		return found;
+
+	// 왼쪽 상단 모서리 기준
+	const Vector2D pos = MathUtils::floor(GetPos());
+	const Vector2D mapSize = _tilemap->GetMapSize();
+	const RECT mapBounds = {
+		static_cast<LONG>(pos.X) - 1,
+		static_cast<LONG>(pos.Y) - 1,
+		static_cast<LONG>(pos.X + mapSize.X * TILE_SIZEX) + 1,
+		static_cast<LONG>(pos.Y + mapSize.Y * TILE_SIZEY) + 1
+	};
+
+	UnionRenderBounds(found, bounds, mapBounds);
+	return true;
+}
+
+void TilemapActor::MarkTileDirty(int32 x, int32 y)
+{
+	if (x < 0 || y < 0)
+		return;
+
+	const int32 chunkX = x / TILE_CHUNK;
+	const int32 chunkY = y / TILE_CHUNK;
+	if (chunkX >= _chunkCountX || chunkY >= _chunkCountY)
+		return;
+
+	_chunks[chunkY * _chunkCountX + chunkX].dirty = true;
+}
+
+void TilemapActor::UpdateChunks()
+{
+	if (_chunkTilemap == _tilemap && _tilemapRevision == _tilemap->GetRevision())
+		return;
+
+	_chunkTilemap = _tilemap;
+	_tilemapRevision = _tilemap->GetRevision();
+
+	const Vector2D mapSize = _tilemap->GetMapSize();
+	_chunkCountX = ((int32)mapSize.X + TILE_CHUNK - 1) / TILE_CHUNK;
+	_chunkCountY = ((int32)mapSize.Y + TILE_CHUNK - 1) / TILE_CHUNK;
+
+	// texture는 그대로 두고 다시 그리기만 한다. (크기가 같으면 재사용)
+	_chunks.resize(_chunkCountX * _chunkCountY);
+	for (TilemapChunk& chunk : _chunks)
+		chunk.dirty = true;
+}
+
+void TilemapActor::BakeChunk(int32 chunkX, int32 chunkY)
+{
+	TilemapChunk& chunk = _chunks[chunkY * _chunkCountX + chunkX];
+	chunk.dirty = false;
+
+	if (_spriteO == nullptr || _spriteX == nullptr)
+		return;
+
+	const Vector2D mapSize = _tilemap->GetMapSize();
+	std::vector<std::vector<Tile>>& tiles = _tilemap->GetTiles();
+
+	// 맵의 끝쪽 chunk는 남은 tile만큼만
+	const int32 startX = chunkX * TILE_CHUNK;
+	const int32 startY = chunkY * TILE_CHUNK;
+	const int32 countX = min(TILE_CHUNK, (int32)mapSize.X - startX);
+	const int32 countY = min(TILE_CHUNK, (int32)mapSize.Y - startY);
+	const int32 width = countX * TILE_SIZEX;
+	const int32 height = countY * TILE_SIZEY;
+
+	// 두 sprite는 같은 Tile texture를 사용
+	const Texture& tileTexture = *_spriteO->GetTexture();
+	const uint32 transparent = tileTexture.GetTransparent();
+	const uint32 key = BlitUtils::ToPixel(transparent);
+
+	std::vector<uint32> pixels(static_cast<size_t>(width) * height, key);
+	for (int32 y = 0; y < countY; ++y) {
+		for (int32 x = 0; x < countX; ++x) {
+			std::shared_ptr<Sprite> sprite = nullptr;
+			switch (tiles[startY + y][startX + x].value) {
+			case 0: sprite = _spriteO; break;
+			case 1: sprite = _spriteX; break;
 			}
+
+			if (sprite == nullptr)
+				continue;
+
+			const Texture& texture = *sprite->GetTexture();
+			BlitUtils::BlitColorKey(pixels.data(), width, height, x * TILE_SIZEX, y * TILE_SIZEY,
+				texture.GetPixels(), texture.GetWidth(), texture.GetHeight(),
+				(int32)sprite->GetSpritePos().X, (int32)sprite->GetSpritePos().Y, TILE_SIZEX, TILE_SIZEY, key);
 		}
 	}
 
+	if (chunk.texture == nullptr)
+		chunk.texture = std::make_shared<Texture>();
+
+	// Create 전에 설정해야 구간을 한번만 구한다.
+	chunk.texture->SetTransparent(transparent);
+	chunk.texture->Create(GET_SINGLE(AssetManager)->GetHwnd(), width, height, std::move(pixels));
 }
 
 void TilemapActor::TickPicking()
 {
 	if (GET_SINGLE(InputManager)->GetEventDown(KeyType::LeftMouse)) {
 		const Vector2D cam = World::GetCameraPos();
-		// ī޶ ǥ - ȭ  ũ (WinAPI   𼭸  ׸⿡  )
-		const Vector2D screenPos = cam - Engine::GetScreenSize() * 0.5f; //  ȭ ǥ
+		// 카메라의 좌표 - 화면의 절반 크기 (WinAPI는 왼쪽 상당 모서리를 기준으로 그리기에 보정을 해줬었다)
+		const Vector2D screenPos = cam - Engine::GetScreenSize() * 0.5f; // 월드의 화면 좌표
 		
 		const Vector2D mousePos = GET_SINGLE(InputManager)->GetMousePos();
 
-		//  ǥ
+		// 월드 좌표
 		Vector2D pos = mousePos + screenPos;
-		//  ǥ  Tile pickߴ
+		// 월드 좌표에서 어느 Tile을 pick했는지
 		pos *= Vector2D(1 / (float)TILE_SIZEX, 1 / (float)TILE_SIZEY);
 		
 		Tile* tile = _tilemap->GetTileAt(pos);
 		if (tile) {
-			// TODO :  Tile  
- 			tile->value = tile->value ^ 1; // 0 1   ְ xor ȯ
+			// TODO : 여러가지 Tile 값 설정
+ 			tile->value = tile->value ^ 1; // 0과 1 설정할 수 있게 xor로 변환
+			MarkTileDirty((int32)pos.X, (int32)pos.Y);
 		}
 	}
 }
@@ -159,3 +248,15 @@ Vector2D TilemapActor::GetCellPos(const Vector2D& cellPos)
 
 	return tilePos;
 }
+
+TileSweepResult TilemapActor::SweepBox(const Vector2D& center, const Vector2D& halfSize, const Vector2D& move)
+{
+	if (_tilemap == nullptr) {
+		TileSweepResult result;
+		result.move = move;
+		return result;
+	}
+
+	// Tilemap의 왼쪽 상단 기준 좌표로 바꿔서 검사
+	return _tilemap->SweepBox(center - GetPos(), halfSize, move);
+}
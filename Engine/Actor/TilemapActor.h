@@ -3,6 +3,8 @@
 
 class Tilemap;
 class Sprite;
+class Texture;
+struct TileSweepResult;
 
 enum TILE_SIZE {
 	TILE_WIDTH = 63,
@@ -11,6 +13,14 @@ enum TILE_SIZE {
 	TILE_SIZEY = 48
 };
 
+// 미리 그려둔 tile 묶음 (TILE_CHUNK x TILE_CHUNK개의 tile을 texture 하나로)
+constexpr int32 TILE_CHUNK = 16;
+
+struct TilemapChunk {
+	std::shared_ptr<Texture> texture;	// tile이 없는 곳은 Tile texture의 transparent 색
+	bool dirty = true;					// 다음 Render에서 다시 그린다.
+};
+
 class TilemapActor : public Actor
 {
 	GENERATE_BODY(TilemapActor, Actor)
@@ -18,23 +28,43 @@ public:
 
 	virtual void Init() override;
 	virtual void Tick(float DeltaTime) override;
-	virtual void Render(HDC hdc) override;
+	virtual void Render(RenderTarget& target) override;
+	virtual bool GetRenderBounds(RECT& bounds) override;
 
 	void TickPicking();
 
-	// Tilemap  ǥ ȯ 
+	// Tilemap 기반의 좌표로 변환 
 	Vector2D ConvertToTilemapPos(Vector2D pos);
 	Vector2D GetCellPos(const Vector2D& cellPos);
+
+	// World 좌표의 사각형을 move만큼 이동할때 처음 막히는 tile과 이동할 수 있는 만큼
+	TileSweepResult SweepBox(const Vector2D& center, const Vector2D& halfSize, const Vector2D& move);
 public:
-	void SetTilemap(std::shared_ptr<Tilemap> tilemap) { _tilemap = tilemap;	}
+	void SetTilemap(std::shared_ptr<Tilemap> tilemap) { _tilemap = tilemap; MarkRenderDirty(); }
 	std::shared_ptr<Tilemap> GetTilemap() {return _tilemap; }
 
 	void SetShowDebug(bool showDebug) { _showDebug = showDebug; }
+
+	// tile을 바꾼 뒤 호출 (그 tile이 있는 chunk만 다시 그린다)
+	void MarkTileDirty(int32 x, int32 y);
+
+private:
+	// Tilemap의 크기나 내용이 통째로 바뀌었으면 chunk를 다시 나눈다.
+	void UpdateChunks();
+	void BakeChunk(int32 chunkX, int32 chunkY);
+
 private:
-	// TODO: ظϸ Component ٲֱ
+	// TODO: 왠만하면 Component로 바꿔주기
 	std::shared_ptr<Tilemap> _tilemap;
 	std::shared_ptr<Sprite> _spriteX;
 	std::shared_ptr<Sprite> _spriteO;
 	bool _showDebug = false;
+
+	std::vector<TilemapChunk> _chunks;
+	int32 _chunkCountX = 0;
+	int32 _chunkCountY = 0;
+	uint32 _tilemapRevision = 0;
+	uint32 _boundsRevision = 0;				// 그리는 영역을 구한 Tilemap revision (LoadTilemap으로 크기가 바뀔 수 있다)
+	std::shared_ptr<Tilemap> _chunkTilemap;		// chunk를 만든 Tilemap (SetTilemap으로 바뀌었는지 확인)
 };
 
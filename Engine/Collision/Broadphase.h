@@ -0,0 +1,38 @@
+#pragma once
+
+struct ColliderArrays;
+class CollisionLayerTable;
+
+// 충돌 검사할 두 Collider의 index (ColliderArrays의 row 기준, src < dest)
+struct CollisionPair {
+	int32 src;
+	int32 dest;
+
+	bool operator<(const CollisionPair& other) const {
+		if (src != other.src)
+			return src < other.src;
+		return dest < other.dest;
+	}
+	bool operator==(const CollisionPair& other) const {
+		return src == other.src && dest == other.dest;
+	}
+};
+
+/*
+	Broadphase
+		- 모든 Collider끼리 검사하지 않고 충돌 가능성이 있는 pair만 골라낸다.
+		- 찾은 pair는 index 순서로 정렬해 넘겨줘야 충돌 이벤트 순서가 항상 같다.
+		- layer 테이블에서 서로 충돌할 수 없는 layer끼리는 pair를 만들지 않는다.
+		- 둘 다 움직이지 않은(arrays.resting) Collider끼리는 pair를 만들지 않는다.
+*/
+class Broadphase
+{
+public:
+	Broadphase() {}
+	virtual ~Broadphase() {}
+
+	virtual void FindPairs(const ColliderArrays& arrays, const CollisionLayerTable& layerTable, std::vector<CollisionPair>& pairs) = 0;
+
+	// bounds와 겹칠 수 있는 row들을 정렬된 상태로 찾아준다. (마지막 FindPairs의 arrays 기준, Raycast/Overlap 검사용)
+	virtual void Query(const ColliderArrays& arrays, const RECT& bounds, std::vector<int32>& rows) = 0;
+};
@@ -0,0 +1,94 @@
+#include "pch.h"
+#include "ColliderArrays.h"
+#include "CollisionLayerTable.h"
+#include "Component\Collider.h"
+
+void ColliderArrays::Clear()
+{
+	// capacity는 남겨두고 다음 Tick에 재사용
+	minX.clear(); minY.clear(); maxX.clear(); maxY.clear();
+	centerX.clear(); centerY.clear(); radius.clear();
+	prevCenterX.clear(); prevCenterY.clear();
+	types.clear();
+	layers.clear();
+	flags.clear();
+	layerIndices.clear();
+	ids.clear();
+	owners.clear();
+	continuous.clear();
+	resting.clear();
+	rows.clear();
+}
+
+void ColliderArrays::Build(const std::vector<std::shared_ptr<Collider>>& colliders)
+{
+	Clear();
+	rows.resize(colliders.size(), -1);
+
+	for (int32 i = 0; i < colliders.size(); ++i) {
+		Collider* collider = colliders[i].get();
+		if (collider->GetCollisionEnable() == false)
+			continue;
+
+		// 움직이지 않았으면 Collider에 cache된 값을 그대로 사용
+		const FixedBounds& bounds = collider->GetFixedBounds();
+
+		rows[i] = Size();
+
+		minX.push_back(FixedBounds::ToFloat(bounds.minX));
+		minY.push_back(FixedBounds::ToFloat(bounds.minY));
+		maxX.push_back(FixedBounds::ToFloat(bounds.maxX));
+		maxY.push_back(FixedBounds::ToFloat(bounds.maxY));
+
+		centerX.push_back(FixedBounds::ToFloat(bounds.centerX));
+		centerY.push_back(FixedBounds::ToFloat(bounds.centerY));
+		radius.push_back(FixedBounds::ToFloat(bounds.radius));
+
+		// 이전 위치도 같은 단위로 맞춰서 이동량이 정확하게 나오도록
+		const Vector2D prevPos = collider->GetPrevPos();
+		const int32 prevX = FixedBounds::ToFixed(prevPos.X);
+		const int32 prevY = FixedBounds::ToFixed(prevPos.Y);
+		prevCenterX.push_back(FixedBounds::ToFloat(prevX));
+		prevCenterY.push_back(FixedBounds::ToFloat(prevY));
+
+		types.push_back(collider->GetColliderType());
+		layers.push_back(collider->GetCollisionLayer());
+		flags.push_back(collider->GetCollisionFlag());
+		layerIndices.push_back(CollisionLayerTable::ToLayerIndex(collider->GetCollisionLayer()));
+		ids.push_back(collider->GetCollisionId());
+		owners.push_back(i);
+		continuous.push_back(collider->IsContinuous());
+		// 깨우지 않고 옮겼더라도 위치가 바뀌었으면 이번 Tick은 검사
+		resting.push_back(collider->IsResting() && prevX == bounds.centerX && prevY == bounds.centerY);
+	}
+}
+
+int32 ColliderArrays::FindRow(uint32 id) const
+{
+	// colliders 순서대로 넣었으므로 ids는 정렬되어 있다.
+	auto it = std::lower_bound(ids.begin(), ids.end(), id);
+	if (it == ids.end() || *it != id)
+		return -1;
+	return static_cast<int32>(it - ids.begin());
+}
+
+RECT ColliderArrays::GetBounds(int32 row) const
+{
+	float left = minX[row], top = minY[row], right = maxX[row], bottom = maxY[row];
+
+	// 이동한 경로에 있는 Collider도 pair로 찾을 수 있도록 이전 위치의 AABB까지 포함
+	// (continuous 검사는 상대 이동으로 하므로 상대쪽 Collider의 이동 경로도 포함되어야 한다)
+	const float offsetX = prevCenterX[row] - centerX[row];
+	const float offsetY = prevCenterY[row] - centerY[row];
+	left = min(left, left + offsetX);
+	top = min(top, top + offsetY);
+	right = max(right, right + offsetX);
+	bottom = max(bottom, bottom + offsetY);
+
+	return {
+		static_cast<LONG>(std::floor(left)),
+		static_cast<LONG>(std::floor(top)),
+		static_cast<LONG>(std::ceil(right)),
+		static_cast<LONG>(std::ceil(bottom))
+	};
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+class Collider;
+
+/*
+	Collider Structure Of Arrays
+		- 매 Tick 한번 Collider에 cache된 bounds(FixedBounds)를 복사해 연속된 배열로 가지고 있는다.
+		- 값은 모두 1/256 pixel 단위라 narrowphase 결과(겹친 크기 등)가 항상 같다.
+		- Broadphase와 narrowphase는 shared_ptr, virtual 함수, dynamic_pointer_cast 없이 이 배열만 사용한다.
+		- 활성화된 Collider만 넣는다. (row = 배열 index, owners[row] = colliders 배열에서의 index)
+*/
+struct ColliderArrays
+{
+	void Clear();
+	void Build(const std::vector<std::shared_ptr<Collider>>& colliders);
+
+	int32 Size() const { return static_cast<int32>(owners.size()); }
+
+	// Broadphase용 정수 bounds (AABB를 모두 포함하도록 내림/올림, 이전 위치부터 이동한 경로까지)
+	RECT GetBounds(int32 row) const;
+
+	// Collider id로 row 찾기 (없으면 -1)
+	int32 FindRow(uint32 id) const;
+
+	// AABB (World 좌표)
+	std::vector<float> minX, minY, maxX, maxY;
+	// 중심과 반지름 (Square는 radius = 0)
+	std::vector<float> centerX, centerY, radius;
+	// 이전 Tick의 중심 (Swept 검사용)
+	std::vector<float> prevCenterX, prevCenterY;
+
+	std::vector<ColliderType> types;
+	std::vector<uint8> layers;			// 자신이 무엇인지 (CollisionLayerType)
+	std::vector<uint8> flags;			// 누구랑 충돌할지
+	std::vector<int32> layerIndices;	// layer bucket index
+	std::vector<uint32> ids;			// CollisionManager에서 부여한 고유 id
+	std::vector<int32> owners;			// colliders 배열에서의 index
+	std::vector<uint8> continuous;		// 1 = 이동 경로로 검사 (빠르게 움직이는 Collider)
+	std::vector<uint8> resting;			// 1 = 지난 Tick부터 움직이지 않은 Static/Sleep Collider
+
+	// colliders index -> row (비활성화된 Collider는 -1)
+	std::vector<int32> rows;
+};
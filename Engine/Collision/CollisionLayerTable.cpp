@@ -0,0 +1,50 @@
+#include "pch.h"
+#include "CollisionLayerTable.h"
+
+namespace {
+	// index = (A가 B를 원하는지) | (B가 A를 원하는지 << 1)
+	constexpr CollisionResponse RESPONSES[4] = {
+		CollisionResponse::CR_Ignore,
+		CollisionResponse::CR_Overlap,
+		CollisionResponse::CR_Overlap,
+		CollisionResponse::CR_Hit
+	};
+}
+
+CollisionLayerTable::CollisionLayerTable()
+{
+}
+
+CollisionLayerTable::~CollisionLayerTable()
+{
+}
+
+void CollisionLayerTable::Build(const uint8 (&layerFlags)[LAYER_COUNT])
+{
+	for (int32 a = 0; a < LAYER_COUNT; ++a) {
+		_masks[a] = 0;
+
+		for (int32 b = 0; b < LAYER_COUNT; ++b) {
+			const uint8 layerA = static_cast<uint8>(1u << a);
+			const uint8 layerB = static_cast<uint8>(1u << b);
+
+			_responses[a][b] = GetResponse(layerA, layerFlags[a], layerB, layerFlags[b]);
+			if (_responses[a][b] != CollisionResponse::CR_Ignore)
+				_masks[a] |= layerB;
+		}
+	}
+}
+
+CollisionResponse CollisionLayerTable::GetResponse(uint8 layerA, uint8 flagA, uint8 layerB, uint8 flagB)
+{
+	const int32 index = ((flagA & layerB) != 0) | (((flagB & layerA) != 0) << 1);
+	return RESPONSES[index];
+}
+
+int32 CollisionLayerTable::ToLayerIndex(uint8 layer)
+{
+	int32 index = 0;
+	while (index < LAYER_COUNT - 1 && (layer & (1u << index)) == 0)
+		++index;
+	return index;
+}
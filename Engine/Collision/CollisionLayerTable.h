@@ -0,0 +1,41 @@
+#pragma once
+
+/*
+	Layer x Layer 충돌 테이블
+		- CollisionLayerType(bit) 하나당 bucket 하나로 보고, 같은 layer를 가진 Collider들의 flag를 모아
+		  두 bucket이 서로 충돌할 수 있는지(Ignore/Overlap/Hit) 미리 계산해둔다.
+		- Broadphase는 Ignore인 bucket끼리는 pair를 만들지 않는다.
+		- pair 하나의 반응도 분기 없이 표에서 바로 찾는다.
+*/
+class CollisionLayerTable
+{
+public:
+	// CollisionLayerType은 uint8 bitflag이므로 최대 8개의 layer
+	static constexpr int32 LAYER_COUNT = 8;
+
+	CollisionLayerTable();
+	~CollisionLayerTable();
+
+	// 모든 Collider의 layer와 flag로 테이블을 다시 만든다.
+	void Build(const uint8 (&layerFlags)[LAYER_COUNT]);
+
+	CollisionResponse GetLayerResponse(int32 layerIndexA, int32 layerIndexB) const { return _responses[layerIndexA][layerIndexB]; }
+
+	// 두 layer의 bucket끼리 충돌할 수 있는지
+	bool CanCollide(int32 layerIndexA, int32 layerIndexB) const { return (_masks[layerIndexA] >> layerIndexB) & 1; }
+	// 어떤 layer와도 충돌하지 않는 bucket인지
+	bool IsIgnored(int32 layerIndex) const { return _masks[layerIndex] == 0; }
+	// layerIndex bucket과 충돌할 수 있는 layer bit들
+	uint8 GetCollidableLayers(int32 layerIndex) const { return _masks[layerIndex]; }
+
+public:
+	// Collider 두 개의 반응
+	static CollisionResponse GetResponse(uint8 layerA, uint8 flagA, uint8 layerB, uint8 flagB);
+	// layer bit -> bucket index (ex: CLT_Trace(1 << 4) -> 4)
+	static int32 ToLayerIndex(uint8 layer);
+
+private:
+	CollisionResponse _responses[LAYER_COUNT][LAYER_COUNT] = {};
+	// _masks[a]의 b번째 bit = a와 b bucket이 충돌할 수 있는지
+	uint8 _masks[LAYER_COUNT] = {};
+};
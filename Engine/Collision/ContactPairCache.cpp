@@ -0,0 +1,66 @@
+#include "pch.h"
+#include "ContactPairCache.h"
+
+ContactPairCache::ContactPairCache()
+{
+}
+
+ContactPairCache::~ContactPairCache()
+{
+}
+
+void ContactPairCache::Update(const std::vector<uint64>& contacts, std::vector<ContactChange>& changes)
+{
+	changes.clear();
+
+	// 이전 목록은 _prevContacts로 옮기고 메모리는 재사용
+	_prevContacts.swap(_contacts);
+	_contacts.assign(contacts.begin(), contacts.end());
+
+	// 두 정렬된 목록을 같이 순회 : 새로 생긴 key = Begin, 사라진 key = End
+	int32 prev = 0;
+	int32 curr = 0;
+	while (prev < _prevContacts.size() || curr < _contacts.size()) {
+		if (curr == _contacts.size() || (prev < _prevContacts.size() && _prevContacts[prev] < _contacts[curr])) {
+			changes.push_back({ _prevContacts[prev], false });
+			_lookup.erase(_prevContacts[prev]);
+			++prev;
+		}
+		else if (prev == _prevContacts.size() || _contacts[curr] < _prevContacts[prev]) {
+			changes.push_back({ _contacts[curr], true });
+			_lookup.insert(_contacts[curr]);
+			++curr;
+		}
+		else {
+			// 계속 충돌중
+			++prev;
+			++curr;
+		}
+	}
+}
+
+void ContactPairCache::Remove(uint32 id)
+{
+	auto it = std::remove_if(_contacts.begin(), _contacts.end(), [this, id](uint64 key) {
+		if (GetFirstId(key) != id && GetSecondId(key) != id)
+			return false;
+
+		_lookup.erase(key);
+		return true;
+	});
+	_contacts.erase(it, _contacts.end());
+}
+
+void ContactPairCache::Clear()
+{
+	_contacts.clear();
+	_prevContacts.clear();
+	_lookup.clear();
+}
+
+uint64 ContactPairCache::MakeKey(uint32 a, uint32 b)
+{
+	if (a > b)
+		std::swap(a, b);
+	return (static_cast<uint64>(a) << 32) | b;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+// 이번 Tick에 충돌이 시작됐는지(begin), 끝났는지(end)
+struct ContactChange {
+	uint64 key;
+	bool begin;
+};
+
+/*
+	Contact Pair Cache
+		- 충돌중인 Collider pair를 두 Collider id로 만든 정수 key로 한 곳에서 관리한다.
+		- 매 Tick 충돌한 pair 목록(정렬)을 이전 Tick 목록과 비교해 Begin/End를 찾는다.
+		- Collider마다 shared_ptr set을 가지지 않으므로 hash/refcount 비용 없이 IsCollided를 확인할 수 있다.
+*/
+class ContactPairCache
+{
+public:
+	ContactPairCache();
+	~ContactPairCache();
+
+	// contacts = 이번 Tick 충돌한 pair key (정렬된 상태), changes = key 순서대로 시작/끝난 pair
+	void Update(const std::vector<uint64>& contacts, std::vector<ContactChange>& changes);
+
+	bool Contains(uint32 a, uint32 b) const { return _lookup.contains(MakeKey(a, b)); }
+
+	// Collider가 제거되면 이벤트 없이 관련된 pair를 모두 지운다.
+	void Remove(uint32 id);
+	void Clear();
+
+	const std::vector<uint64>& GetContacts() const { return _contacts; }
+
+public:
+	// 작은 id가 앞쪽(상위 32bit)
+	static uint64 MakeKey(uint32 a, uint32 b);
+	static uint32 GetFirstId(uint64 key) { return static_cast<uint32>(key >> 32); }
+	static uint32 GetSecondId(uint64 key) { return static_cast<uint32>(key); }
+
+private:
+	// 충돌중인 pair (정렬된 상태)
+	std::vector<uint64> _contacts;
+	std::vector<uint64> _prevContacts;
+	std::unordered_set<uint64> _lookup;
+};
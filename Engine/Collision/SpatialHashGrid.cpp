@@ -0,0 +1,239 @@
+#include "pch.h"
+#include "SpatialHashGrid.h"
+#include "ColliderArrays.h"
+#include "CollisionLayerTable.h"
+
+SpatialHashGrid::SpatialHashGrid(int32 cellSize) : _cellSize(max(1, cellSize))
+{
+}
+
+SpatialHashGrid::~SpatialHashGrid()
+{
+}
+
+void SpatialHashGrid::Clear()
+{
+	// 지난 Tick에 비어있던 cell은 지우고 나머지는 메모리를 재사용
+	for (auto it = _cells.begin(); it != _cells.end();) {
+		if (it->second.empty())
+			it = _cells.erase(it);
+		else {
+			it->second.clear();
+			++it;
+		}
+	}
+}
+
+void SpatialHashGrid::Insert(int32 index, const RECT& bounds)
+{
+	const int32 minX = ToCell(bounds.left);
+	const int32 minY = ToCell(bounds.top);
+	const int32 maxX = ToCell(bounds.right);
+	const int32 maxY = ToCell(bounds.bottom);
+
+	for (int32 y = minY; y <= maxY; ++y)
+		for (int32 x = minX; x <= maxX; ++x)
+			_cells[MakeKey(x, y)].push_back(index);
+}
+
+void SpatialHashGrid::FindPairs(const ColliderArrays& arrays, const CollisionLayerTable& layerTable, std::vector<CollisionPair>& pairs)
+{
+	Clear();
+	UpdateRestingCells(arrays);
+
+	// 어떤 layer와도 충돌하지 않는 Collider도 Query에서 찾을 수 있도록 격자에는 모두 넣는다.
+	// (pair는 아래에서 cell, layer 단위로 걸러진다)
+	const std::vector<int32>& layers = arrays.layerIndices;
+	for (int32 i = 0; i < arrays.Size(); ++i) {
+		if (arrays.resting[i] == false)
+			Insert(i, arrays.GetBounds(i));
+	}
+
+	// 움직이는 Collider가 있는 cell만 확인 (움직이지 않는 Collider끼리는 pair를 만들지 않는다)
+	for (auto& [key, indices] : _cells) {
+		if (indices.empty())
+			continue;
+
+		GetRestingRows(arrays, key, _restingRows);
+		if (indices.size() + _restingRows.size() < 2)
+			continue;
+
+		// cell 안의 layer들끼리 하나도 충돌할 수 없으면 cell 전체를 건너뛴다.
+		uint8 cellLayers = 0;
+		uint8 collidableLayers = 0;
+		for (int32 index : indices) {
+			cellLayers |= static_cast<uint8>(1u << layers[index]);
+			collidableLayers |= layerTable.GetCollidableLayers(layers[index]);
+		}
+		for (int32 index : _restingRows)
+			cellLayers |= static_cast<uint8>(1u << layers[index]);
+		if ((cellLayers & collidableLayers) == 0)
+			continue;
+
+		// index 순서대로 Insert했으므로 cell 안의 index는 이미 정렬되어 있다.
+		for (int32 i = 0; i < indices.size(); ++i) {
+			const int32 layerIndex = layers[indices[i]];
+			for (int32 j = i + 1; j < indices.size(); ++j) {
+				if (layerTable.CanCollide(layerIndex, layers[indices[j]]))
+					pairs.push_back({ indices[i], indices[j] });
+			}
+
+			// 움직이는 Collider - 움직이지 않는 Collider
+			for (int32 other : _restingRows) {
+				if (layerTable.CanCollide(layerIndex, layers[other]))
+					pairs.push_back({ min(indices[i], other), max(indices[i], other) });
+			}
+		}
+	}
+
+	// 여러 cell에 걸친 Collider는 같은 pair가 여러번 나올 수 있으니 중복 제거
+	// 정렬해두면 기존 O(n^2) 순회와 같은 순서로 충돌 이벤트가 발생한다.
+	std::sort(pairs.begin(), pairs.end());
+	pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+}
+
+void SpatialHashGrid::Query(const ColliderArrays& arrays, const RECT& bounds, std::vector<int32>& rows)
+{
+	const int32 minX = ToCell(bounds.left);
+	const int32 minY = ToCell(bounds.top);
+	const int32 maxX = ToCell(bounds.right);
+	const int32 maxY = ToCell(bounds.bottom);
+
+	auto addRow = [&](int32 index) {
+		const RECT other = arrays.GetBounds(index);
+		if (other.left <= bounds.right && bounds.left <= other.right && other.top <= bounds.bottom && bounds.top <= other.bottom)
+			rows.push_back(index);
+	};
+	auto addCell = [&](uint64 key) {
+		auto it = _cells.find(key);
+		if (it != _cells.end()) {
+			for (int32 index : it->second)
+				addRow(index);
+		}
+
+		GetRestingRows(arrays, key, _restingRows);
+		for (int32 index : _restingRows)
+			addRow(index);
+	};
+	auto isInside = [&](uint64 key) {
+		const int32 x = static_cast<int32>(key >> 32);
+		const int32 y = static_cast<int32>(static_cast<uint32>(key));
+		return minX <= x && x <= maxX && minY <= y && y <= maxY;
+	};
+
+	// 범위가 넓으면 (긴 Raycast 등) 범위 안의 cell을 모두 찾는 것보다 있는 cell만 확인하는게 빠르다.
+	const int64 cellCount = static_cast<int64>(maxX - minX + 1) * (maxY - minY + 1);
+	if (cellCount > static_cast<int64>(_cells.size() + _restingCells.size())) {
+		for (auto& [key, indices] : _cells) {
+			if (isInside(key))
+				addCell(key);
+		}
+		// 움직이는 Collider가 없는 cell
+		for (auto& [key, ids] : _restingCells) {
+			if (isInside(key) && _cells.contains(key) == false)
+				addCell(key);
+		}
+	}
+	else {
+		for (int32 y = minY; y <= maxY; ++y)
+			for (int32 x = minX; x <= maxX; ++x)
+				addCell(MakeKey(x, y));
+	}
+
+	std::sort(rows.begin(), rows.end());
+	rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+}
+
+void SpatialHashGrid::UpdateRestingCells(const ColliderArrays& arrays)
+{
+	_nextRestingIds.clear();
+	for (int32 i = 0; i < arrays.Size(); ++i) {
+		if (arrays.resting[i])
+			_nextRestingIds.push_back(arrays.ids[i]);
+	}
+
+	// 대부분의 Tick은 바뀐 것이 없다.
+	if (_nextRestingIds == _restingIds)
+		return;
+
+	// 더 이상 움직이지 않는 상태가 아니거나 제거된 Collider는 빼고
+	_changedIds.clear();
+	std::set_difference(_restingIds.begin(), _restingIds.end(), _nextRestingIds.begin(), _nextRestingIds.end(), std::back_inserter(_changedIds));
+	for (uint32 id : _changedIds) {
+		auto it = _restingBounds.find(id);
+		if (it == _restingBounds.end())
+			continue;
+
+		const RECT& bounds = it->second;
+		for (int32 y = ToCell(bounds.top); y <= ToCell(bounds.bottom); ++y) {
+			for (int32 x = ToCell(bounds.left); x <= ToCell(bounds.right); ++x) {
+				auto cell = _restingCells.find(MakeKey(x, y));
+				if (cell == _restingCells.end())
+					continue;
+
+				std::vector<uint32>& ids = cell->second;
+				ids.erase(std::remove(ids.begin(), ids.end(), id), ids.end());
+				if (ids.empty())
+					_restingCells.erase(cell);
+			}
+		}
+		_restingBounds.erase(it);
+	}
+
+	// 새로 움직이지 않게 된 Collider는 넣는다.
+	_changedIds.clear();
+	std::set_difference(_nextRestingIds.begin(), _nextRestingIds.end(), _restingIds.begin(), _restingIds.end(), std::back_inserter(_changedIds));
+	for (uint32 id : _changedIds) {
+		const RECT bounds = arrays.GetBounds(arrays.FindRow(id));
+		_restingBounds[id] = bounds;
+
+		for (int32 y = ToCell(bounds.top); y <= ToCell(bounds.bottom); ++y)
+			for (int32 x = ToCell(bounds.left); x <= ToCell(bounds.right); ++x)
+				_restingCells[MakeKey(x, y)].push_back(id);
+	}
+
+	_restingIds.swap(_nextRestingIds);
+}
+
+void SpatialHashGrid::ClearResting()
+{
+	_restingCells.clear();
+	_restingBounds.clear();
+	_restingIds.clear();
+}
+
+void SpatialHashGrid::GetRestingRows(const ColliderArrays& arrays, uint64 key, std::vector<int32>& rows) const
+{
+	rows.clear();
+
+	auto it = _restingCells.find(key);
+	if (it == _restingCells.end())
+		return;
+
+	for (uint32 id : it->second) {
+		const int32 row = arrays.FindRow(id);
+		if (row >= 0)
+			rows.push_back(row);
+	}
+}
+
+void SpatialHashGrid::SetCellSize(int32 cellSize)
+{
+	_cellSize = max(1, cellSize);
+	_cells.clear();
+	ClearResting();
+}
+
+int32 SpatialHashGrid::ToCell(LONG value) const
+{
+	// 음수 좌표도 올바른 cell에 들어가도록 내림 나눗셈
+	int32 cell = value / _cellSize;
+	if (value < 0 && value % _cellSize != 0)
+		--cell;
+	return cell;
+}
+
+uint64 SpatialHashGrid::MakeKey(int32 x, int32 y)
+{
+	return (static_cast<uint64>(static_cast<uint32>(x)) << 32) | static_cast<uint32>(y);
+}
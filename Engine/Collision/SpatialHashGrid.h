@@ -0,0 +1,50 @@
+#pragma once
+#include "Broadphase.h"
+
+/*
+	Uniform Grid Spatial Hash (Broadphase)
+		- 매 Tick마다 Collider의 bounds를 cellSize 크기의 격자에 넣고
+		- 같은 cell에 들어간 Collider끼리만 충돌 후보(pair)로 만든다.
+		- cell 좌표를 key로 hash map을 사용하므로 맵 크기와 상관없이 사용할 수 있다.
+		- 움직이지 않는 Collider(Static/Sleep)는 따로 가지고 있다가 바뀐 것만 넣고 뺀다.
+*/
+class SpatialHashGrid : public Broadphase
+{
+public:
+	// 기본값은 Tile(48px) 2칸 크기
+	SpatialHashGrid(int32 cellSize = 96);
+	virtual ~SpatialHashGrid() override;
+
+	// 같은 cell을 공유하는 pair들을 중복없이 정렬된 상태로 찾아준다.
+	virtual void FindPairs(const ColliderArrays& arrays, const CollisionLayerTable& layerTable, std::vector<CollisionPair>& pairs) override;
+	virtual void Query(const ColliderArrays& arrays, const RECT& bounds, std::vector<int32>& rows) override;
+
+	void Clear();
+	void Insert(int32 index, const RECT& bounds);
+
+public:
+	void SetCellSize(int32 cellSize);
+	int32 GetCellSize() const { return _cellSize; }
+
+private:
+	int32 ToCell(LONG value) const;
+	static uint64 MakeKey(int32 x, int32 y);
+
+	void UpdateRestingCells(const ColliderArrays& arrays);
+	void ClearResting();
+	// cell에 있는 움직이지 않는 Collider를 이번 Tick의 row로 변환
+	void GetRestingRows(const ColliderArrays& arrays, uint64 key, std::vector<int32>& rows) const;
+
+private:
+	int32 _cellSize;
+	// key = cell 좌표, value = cell에 들어간 collider index (움직이는 Collider만, 매 Tick 다시 만든다)
+	std::unordered_map<uint64, std::vector<int32>> _cells;
+
+	// 움직이지 않는 Collider (index는 Tick마다 바뀌므로 Collider id로 가지고 있는다)
+	std::unordered_map<uint64, std::vector<uint32>> _restingCells;
+	std::unordered_map<uint32, RECT> _restingBounds; // id -> 넣을때의 bounds
+	std::vector<uint32> _restingIds;	// 정렬된 상태
+	std::vector<uint32> _nextRestingIds;
+	std::vector<uint32> _changedIds;
+	std::vector<int32> _restingRows;
+};
@@ -0,0 +1,175 @@
+#include "pch.h"
+#include "SweepAndPrune.h"
+#include "ColliderArrays.h"
+#include "CollisionLayerTable.h"
+
+SweepAndPrune::SweepAndPrune()
+{
+}
+
+SweepAndPrune::~SweepAndPrune()
+{
+}
+
+void SweepAndPrune::FindPairs(const ColliderArrays& arrays, const CollisionLayerTable& layerTable, std::vector<CollisionPair>& pairs)
+{
+	UpdateProxies(arrays);
+	RemoveStaleProxies();
+
+	for (int32 axis = 0; axis < 2; ++axis) {
+		UpdateEndpoints(axis);
+		SortAxis(axis);
+	}
+
+	// 정렬하면서 갱신된 겹친 pair들을 이번 Tick의 index로 변환
+	// _overlaps는 layer와 상관없이 유지해야 flag가 바뀌어도 다시 pair를 찾을 수 있다.
+	for (uint64 key : _overlaps) {
+		const Proxy& a = _proxies[static_cast<uint32>(key >> 32)];
+		const Proxy& b = _proxies[static_cast<uint32>(key)];
+		if (layerTable.CanCollide(a.layerIndex, b.layerIndex) == false)
+			continue;
+		if (a.resting && b.resting)
+			continue;
+
+		pairs.push_back({ min(a.index, b.index), max(a.index, b.index) });
+	}
+
+	std::sort(pairs.begin(), pairs.end());
+}
+
+void SweepAndPrune::Query(const ColliderArrays& arrays, const RECT& bounds, std::vector<int32>& rows)
+{
+	// X축은 정렬되어 있으므로 bounds.right를 넘는 min endpoint부터는 볼 필요가 없다.
+	const int64 maxKey = static_cast<int64>(bounds.right) * 2;
+	for (const Endpoint& endpoint : _axis[0]) {
+		if (endpoint.key > maxKey)
+			break;
+		if (endpoint.isMin == false)
+			continue;
+
+		const Proxy& proxy = _proxies[endpoint.id];
+		if (IsOverlapped(proxy.bounds, bounds, 0) && IsOverlapped(proxy.bounds, bounds, 1))
+			rows.push_back(proxy.index);
+	}
+
+	std::sort(rows.begin(), rows.end());
+}
+
+void SweepAndPrune::UpdateProxies(const ColliderArrays& arrays)
+{
+	++_tick;
+
+	for (int32 i = 0; i < arrays.Size(); ++i) {
+		const uint32 id = arrays.ids[i];
+
+		auto [it, inserted] = _proxies.try_emplace(id);
+		Proxy& proxy = it->second;
+		proxy.resting = arrays.resting[i];
+		if (inserted || proxy.resting == false)
+			proxy.bounds = arrays.GetBounds(i);
+		proxy.index = i;
+		proxy.tick = _tick;
+		proxy.layerIndex = arrays.layerIndices[i];
+
+		// 새로운 Collider는 endpoint를 배열 끝에 추가 (정렬하면서 제자리를 찾아간다)
+		// 끝에 있으면 아직 아무것과도 겹치지 않은 상태이므로 _overlaps와도 맞다.
+		if (inserted) {
+			for (int32 axis = 0; axis < 2; ++axis) {
+				_axis[axis].push_back({ MakeEndpointKey(proxy.bounds, axis, true), id, true });
+				_axis[axis].push_back({ MakeEndpointKey(proxy.bounds, axis, false), id, false });
+			}
+		}
+	}
+}
+
+void SweepAndPrune::RemoveStaleProxies()
+{
+	// 이번 Tick에 없는 Collider (CollisionManager에서 제거됐거나 비활성화된 Collider)
+	std::unordered_set<uint32> removed;
+	for (auto& [id, proxy] : _proxies) {
+		if (proxy.tick != _tick)
+			removed.insert(id);
+	}
+
+	if (removed.empty())
+		return;
+
+	for (uint32 id : removed)
+		_proxies.erase(id);
+
+	for (auto& endpoints : _axis) {
+		auto it = std::remove_if(endpoints.begin(), endpoints.end(), [&removed](const Endpoint& endpoint) {
+			return removed.contains(endpoint.id);
+		});
+		endpoints.erase(it, endpoints.end());
+	}
+
+	for (auto it = _overlaps.begin(); it != _overlaps.end();) {
+		if (removed.contains(static_cast<uint32>(*it >> 32)) || removed.contains(static_cast<uint32>(*it)))
+			it = _overlaps.erase(it);
+		else
+			++it;
+	}
+}
+
+void SweepAndPrune::UpdateEndpoints(int32 axis)
+{
+	for (Endpoint& endpoint : _axis[axis])
+		endpoint.key = MakeEndpointKey(_proxies[endpoint.id].bounds, axis, endpoint.isMin);
+}
+
+void SweepAndPrune::SortAxis(int32 axis)
+{
+	std::vector<Endpoint>& endpoints = _axis[axis];
+	const int32 otherAxis = 1 - axis;
+
+	// Insertion Sort : 거의 정렬된 상태라면 대부분 바로 끝난다.
+	for (int32 i = 1; i < endpoints.size(); ++i) {
+		const Endpoint endpoint = endpoints[i];
+
+		int32 j = i - 1;
+		while (j >= 0 && endpoints[j].key > endpoint.key) {
+			const Endpoint& prev = endpoints[j];
+
+			// min이 다른 Collider의 max 앞으로 넘어가면 이 축에서 겹치기 시작
+			if (endpoint.isMin && prev.isMin == false) {
+				if (IsOverlapped(_proxies[endpoint.id].bounds, _proxies[prev.id].bounds, otherAxis))
+					_overlaps.insert(MakePairKey(endpoint.id, prev.id));
+			}
+			// max가 다른 Collider의 min 앞으로 넘어가면 이 축에서 더 이상 겹치지 않는다
+			else if (endpoint.isMin == false && prev.isMin) {
+				_overlaps.erase(MakePairKey(endpoint.id, prev.id));
+			}
+
+			endpoints[j + 1] = prev;
+			--j;
+		}
+		endpoints[j + 1] = endpoint;
+	}
+}
+
+bool SweepAndPrune::IsOverlapped(const RECT& a, const RECT& b, int32 axis) const
+{
+	if (axis == 0)
+		return a.left <= b.right && b.left <= a.right;
+
+	return a.top <= b.bottom && b.top <= a.bottom;
+}
+
+int64 SweepAndPrune::MakeEndpointKey(const RECT& bounds, int32 axis, bool isMin)
+{
+	LONG value = 0;
+	if (axis == 0)
+		value = isMin ? bounds.left : bounds.right;
+	else
+		value = isMin ? bounds.top : bounds.bottom;
+
+	return static_cast<int64>(value) * 2 + (isMin ? 0 : 1);
+}
+
+uint64 SweepAndPrune::MakePairKey(uint32 a, uint32 b)
+{
+	if (a > b)
+		std::swap(a, b);
+	return (static_cast<uint64>(a) << 32) | b;
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include "Broadphase.h"
+
+/*
+	Sweep And Prune (Broadphase)
+		- 각 Collider의 bounds를 X, Y축의 min/max endpoint로 나눠 정렬된 상태로 계속 가지고 있는다.
+		- Actor는 Frame 사이에 거의 움직이지 않으므로 이미 거의 정렬된 배열을 Insertion Sort로 다시 정렬하면 O(n)에 가깝다.
+		- 정렬 중 endpoint가 서로 자리를 바꿀 때(swap)만 겹침이 시작/끝나므로 그때 pair를 추가/삭제한다.
+*/
+class SweepAndPrune : public Broadphase
+{
+	struct Endpoint {
+		int64 key;	 // value * 2 + (max이면 1), 같은 값이면 min이 먼저 오도록
+		uint32 id;
+		bool isMin;
+	};
+
+	struct Proxy {
+		RECT bounds = {};
+		int32 index = -1;	// 이번 Tick ColliderArrays에서의 row
+		uint32 tick = 0;	// 마지막으로 갱신된 Tick
+		int32 layerIndex = 0;
+		bool resting = false;	// 움직이지 않으면 bounds를 다시 계산하지 않는다.
+	};
+
+public:
+	SweepAndPrune();
+	virtual ~SweepAndPrune() override;
+
+	virtual void FindPairs(const ColliderArrays& arrays, const CollisionLayerTable& layerTable, std::vector<CollisionPair>& pairs) override;
+	virtual void Query(const ColliderArrays& arrays, const RECT& bounds, std::vector<int32>& rows) override;
+
+private:
+	void UpdateProxies(const ColliderArrays& arrays);
+	void RemoveStaleProxies();
+	void UpdateEndpoints(int32 axis);
+	void SortAxis(int32 axis);
+
+	bool IsOverlapped(const RECT& a, const RECT& b, int32 axis) const;
+	static int64 MakeEndpointKey(const RECT& bounds, int32 axis, bool isMin);
+	static uint64 MakePairKey(uint32 a, uint32 b);
+
+private:
+	// 0 = X축, 1 = Y축
+	std::vector<Endpoint> _axis[2];
+	std::unordered_map<uint32, Proxy> _proxies;
+
+	// 두 축 모두 겹친 pair (key = 두 Collider id)
+	std::unordered_set<uint64> _overlaps;
+
+	uint32 _tick = 0;
+};
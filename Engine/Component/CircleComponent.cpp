@@ -3,7 +3,7 @@
 #include "Actor\Actor.h"
 #include "World\World.h"
 #include "Engine.h"
-#include "Utils\WinUtils.h"
+#include "Render\DebugDraw.h"
 #include "SquareComponent.h"
 
 CircleComponent::CircleComponent() : Collider(ColliderType::CT_Circle) {}
@@ -20,35 +20,24 @@ void CircleComponent::Tick(float DeltaTime)
 	Super::Tick(DeltaTime);
 }
 
-void CircleComponent::Render(HDC hdc)
+void CircleComponent::Render(RenderTarget& target)
 {
-	Super::Render(hdc);
+	Super::Render(target);
+
+	if (IsShowDebug() == false)
+		return;
 
 	const Vector2D camPos = World::GetCameraPos();
 	Vector2D pos = GetPos();
 	pos -= camPos - Engine::GetScreenSize() * 0.5f;
 
-	HPEN myPen = (HPEN)::GetStockObject(DC_PEN);
-	HPEN oldPen = (HPEN)::SelectObject(hdc, myPen);
-
-	HBRUSH myBrush = (HBRUSH)::GetStockObject(NULL_BRUSH);
-	HBRUSH oldBrush = (HBRUSH)::SelectObject(hdc, myBrush);
-
-	::SetDCPenColor(hdc, RGB(255, 0, 0));
-
-	WinUtils::DrawCircle(hdc, pos, static_cast<int32>(_radius));
-
-	::SelectObject(hdc, oldBrush);
-	::DeleteObject(myBrush);
-
-	::SelectObject(hdc, oldPen);
-	::DeleteObject(myPen);
+	DEBUG_DRAW_CIRCLE(DDC_Collider, static_cast<int32>(pos.X), static_cast<int32>(pos.Y), static_cast<int32>(_radius), RGB(255, 0, 0));
 }
 
 
 bool CircleComponent::CheckCollision(std::weak_ptr<Collider> other)
 {
-	if (Super::CheckCollision(other) == false) //  浹  ִ Ȯ
+	if (Super::CheckCollision(other) == false) // 서로 충돌할 수 있는지 확인
 		return false;
 
 	std::shared_ptr<Collider> collider = other.lock();
@@ -6,12 +6,14 @@ class CircleComponent : public Collider
 public:
 	virtual void Init() override;
 	virtual void Tick(float DeltaTime) override;
-	virtual void Render(HDC hdc) override;
+	virtual void Render(RenderTarget& target) override;
 
 	virtual bool CheckCollision(std::weak_ptr<Collider> other);
 public:
-	void SetRadius(const float& radius) { _radius = radius; }
+	void SetRadius(const float& radius) { _radius = radius; OnShapeChanged(); }
 	float GetRadius() const { return _radius; }
+protected:
+	virtual Vector2D GetHalfExtent() const override { return Vector2D(_radius, _radius); }
 private:
 	float _radius = 0.f;
 };
@@ -4,6 +4,9 @@
 #include "SquareComponent.h"
 #include "CircleComponent.h"
 #include "Manager\CollisionManager.h"
+#include "Collision\CollisionLayerTable.h"
+#include "Utils\CollisionUtils.h"
+#include "Render\DebugDraw.h"
 
 Collider::Collider() : _colliderType(ColliderType::CT_Square) {}
 
@@ -15,6 +18,8 @@ Collider::~Collider() {
 
 void Collider::Init()
 {
+	// owner가 정해졌으므로 위치가 바뀌었을 수 있다.
+	_boundsDirty = true;
 	GET_SINGLE(CollisionManager)->AddCollider(shared_from_this());
 }
 
@@ -23,10 +28,25 @@ void Collider::Tick(float DeltaTime)
 	Super::Tick(DeltaTime);
 }
 
-void Collider::Render(HDC hdc)
+void Collider::Render(RenderTarget& target)
 {
-	if (_showDebug == false)
-		return;
+}
+
+bool Collider::IsShowDebug() const
+{
+	return _showDebug && DEBUG_DRAW_ENABLED(DDC_Collider);
+}
+
+bool Collider::GetRenderBounds(RECT& bounds)
+{
+#if USE_DEBUG_DRAW
+	bounds = GetBounds();
+	::InflateRect(&bounds, 2, 2);
+	return true;
+#else
+	// DebugDraw를 뺀 빌드에서는 아무것도 그리지 않는다.
+	return false;
+#endif
 }
 
 void Collider::Clear()
@@ -41,18 +61,133 @@ bool Collider::CheckCollision(std::weak_ptr<Collider> other)
 	if (collider == nullptr || _enable == false || collider->GetCollisionEnable() == false)
 		return false;
 
-	uint8 layer = collider->GetCollisionLayer();
-	uint8 flag = collider->GetCollisionFlag();
+	// 하나라도 상대 layer를 flag로 가지면 충돌 (Overlap, 서로 가지면 Hit)
+	return GetCollisionResponse(collider) != CollisionResponse::CR_Ignore;
+}
 
-	// ϳ 浹 (Overlap)
-	if (GetCollisionFlag() & layer)
-		return true;
+bool Collider::CheckSweptCollision(std::weak_ptr<Collider> other, float& time, Vector2D& normal)
+{
+	if (Collider::CheckCollision(other) == false) // 서로 충돌할 수 있는지 확인
+		return false;
 
-	//  浹 ؾ 浹 (,  Hit), UEó HitEvent  ?
-	//if ((GetCollisionFlag() & layer) && (GetCollisionLayer() & flag))
-	//	return true;
+	std::shared_ptr<Collider> collider = other.lock();
+	const bool selfIsSquare = _colliderType == ColliderType::CT_Square;
+	const bool otherIsSquare = collider->GetColliderType() == ColliderType::CT_Square;
 
-	return false;
+	if (selfIsSquare && otherIsSquare)
+		return CheckSweptSquareToSquare(std::dynamic_pointer_cast<SquareComponent>(shared_from_this()), std::dynamic_pointer_cast<SquareComponent>(collider), time, normal);
+
+	if (selfIsSquare == false && otherIsSquare == false)
+		return CheckSweptCircleToCircle(std::dynamic_pointer_cast<CircleComponent>(shared_from_this()), std::dynamic_pointer_cast<CircleComponent>(collider), time, normal);
+
+	if (selfIsSquare == false)
+		return CheckSweptCircleToSquare(std::dynamic_pointer_cast<CircleComponent>(shared_from_this()), std::dynamic_pointer_cast<SquareComponent>(collider), time, normal);
+
+	// 자신이 Square면 방향을 뒤집는다.
+	if (CheckSweptCircleToSquare(std::dynamic_pointer_cast<CircleComponent>(collider), std::dynamic_pointer_cast<SquareComponent>(shared_from_this()), time, normal) == false)
+		return false;
+	normal = -normal;
+	return true;
+}
+
+bool Collider::IsCollided(std::shared_ptr<Collider> other) const
+{
+	if (other == nullptr)
+		return false;
+	return GET_SINGLE(CollisionManager)->IsCollided(this, other.get());
+}
+
+CollisionResponse Collider::GetCollisionResponse(const std::shared_ptr<Collider>& other) const
+{
+	return CollisionLayerTable::GetResponse(GetCollisionLayer(), GetCollisionFlag(), other->GetCollisionLayer(), other->GetCollisionFlag());
+}
+
+RECT Collider::GetBounds()
+{
+	// 내림/올림으로 모두 포함
+	const FixedBounds& bounds = GetFixedBounds();
+	constexpr int32 fraction = (1 << FixedBounds::FRACTION_BITS) - 1;
+	return {
+		bounds.minX >> FixedBounds::FRACTION_BITS,
+		bounds.minY >> FixedBounds::FRACTION_BITS,
+		(bounds.maxX + fraction) >> FixedBounds::FRACTION_BITS,
+		(bounds.maxY + fraction) >> FixedBounds::FRACTION_BITS
+	};
+}
+
+const FixedBounds& Collider::GetFixedBounds()
+{
+	if (_boundsDirty == false)
+		return _fixedBounds;
+
+	const Vector2D pos = GetPos();
+	const Vector2D halfExtent = GetHalfExtent();
+	const int32 halfX = FixedBounds::ToFixed(halfExtent.X);
+	const int32 halfY = FixedBounds::ToFixed(halfExtent.Y);
+
+	_fixedBounds.centerX = FixedBounds::ToFixed(pos.X);
+	_fixedBounds.centerY = FixedBounds::ToFixed(pos.Y);
+	_fixedBounds.minX = _fixedBounds.centerX - halfX;
+	_fixedBounds.minY = _fixedBounds.centerY - halfY;
+	_fixedBounds.maxX = _fixedBounds.centerX + halfX;
+	_fixedBounds.maxY = _fixedBounds.centerY + halfY;
+	_fixedBounds.radius = _colliderType == ColliderType::CT_Circle ? halfX : 0;
+
+	_boundsDirty = false;
+	return _fixedBounds;
+}
+
+void Collider::SavePrevPos()
+{
+	const Vector2D pos = GetPos();
+
+	// 지난 Tick과 같은 위치면 잠들 준비
+	if (_hasPrevPos && pos == _prevPos)
+		_restTicks = min(_restTicks + 1, SLEEP_TICKS);
+	else
+		_restTicks = 0;
+
+	_prevPos = pos;
+	_hasPrevPos = true;
+
+	// 다음 Tick의 이동은 여기서부터 다시 검사
+	_impactTime = 1.f;
+	_impactNormal = Vector2D::Zero;
+}
+
+void Collider::Wake(bool wakeNeighbours)
+{
+	// 잠들어 있었다면 닿아있던 Collider도 다음 Tick에 다시 검사하도록
+	if (wakeNeighbours && IsResting())
+		GET_SINGLE(CollisionManager)->RequestWake(_collisionId);
+
+	_restTicks = 0;
+}
+
+void Collider::OnShapeChanged()
+{
+	_boundsDirty = true;
+	Wake();
+
+	// debug 도형 크기가 바뀌므로 owner가 그리는 영역도 바뀐다. (Component::AddLocalPos와 같다)
+	if (std::shared_ptr<Actor> owner = GetOwner())
+		owner->MarkRenderDirty();
+}
+
+void Collider::SetImpact(float time, Vector2D normal)
+{
+	// 여러 Collider와 부딪혔으면 가장 먼저 부딪힌 것
+	if (time >= _impactTime)
+		return;
+
+	_impactTime = time;
+	_impactNormal = normal;
+}
+
+Vector2D Collider::GetImpactPos() const
+{
+	const Vector2D prevPos = GetPrevPos();
+	return prevPos + (GetPos() - prevPos) * _impactTime;
 }
 
 void Collider::OnComponentBeginOverlap(std::shared_ptr<Collider> collider, std::shared_ptr<Collider> other)
@@ -65,6 +200,11 @@ void Collider::OnComponentEndOverlap(std::shared_ptr<Collider> collider, std::sh
 	_endOverlapDelegate(collider, other->GetOwner(), other);
 }
 
+void Collider::OnComponentHit(std::shared_ptr<Collider> collider, std::shared_ptr<Collider> other)
+{
+	_hitDelegate(collider, other->GetOwner(), other);
+}
+
 // https://blog.naver.com/winterwolfs/10165506488
 bool Collider::CheckCollisionSquareToSqaure(std::weak_ptr<SquareComponent> b1, std::weak_ptr<SquareComponent> b2)
 {
@@ -75,48 +215,21 @@ bool Collider::CheckCollisionSquareToSqaure(std::weak_ptr<SquareComponent> b1, s
 	if (square2 == nullptr)
 		return false;
 
-	RECT r1 = square1->GetRect();
-	RECT r2 = square2->GetRect();
+	// cache된 bounds 사용 (ColliderArrays와 같은 값이므로 CollisionManager와 결과가 같다)
+	const FixedBounds& bounds1 = square1->GetFixedBounds();
+	const FixedBounds& bounds2 = square2->GetFixedBounds();
+	const float minX1 = FixedBounds::ToFloat(bounds1.minX), minY1 = FixedBounds::ToFloat(bounds1.minY), maxX1 = FixedBounds::ToFloat(bounds1.maxX), maxY1 = FixedBounds::ToFloat(bounds1.maxY);
+	const float minX2 = FixedBounds::ToFloat(bounds2.minX), minY2 = FixedBounds::ToFloat(bounds2.minY), maxX2 = FixedBounds::ToFloat(bounds2.maxX), maxY2 = FixedBounds::ToFloat(bounds2.maxY);
 
-	RECT intersect = {};
+	bool check = CollisionUtils::BoxToBox(minX1, minY1, maxX1, maxY1, minX2, minY2, maxX2, maxY2);
 
-	// ġ  ˷ش.
-	bool check = ::IntersectRect(&intersect, &r1, &r2);
-	
-	{
-		// ִ   (Ȯ ʴ)
-		// Frame    ʴ´.  ?
-		Vector2D intersectVec = Vector2D::Zero;
-		
-		// Ȯ ģ ŭ Ѵٸ border ĥ ִ. (̼Ѹŭ ߰  ش)
-		int32 w = intersect.right - intersect.left + 1;
-		int32 h = intersect.bottom - intersect.top + 1;
-
-		if (w > h) {
-			//  浹
-			if (intersect.top == r2.top) {
-				intersectVec.Y += h;
-			}
-			else {
-				intersectVec.Y -= h;
-			}
-		}
-		else {
-			// ʿ 浹
-			if (intersect.left == r2.left) {
-				intersectVec.X += w;
-			}
-			else {
-				intersectVec.X -= w;
-			}
-		}
-
-		SetIntersect(intersectVec);
-	}
+	// 겹친 영역만큼 되돌아가야 할 크기
+	if (check)
+		SetIntersect(CollisionUtils::GetPenetration(minX1, minY1, maxX1, maxY1, minX2, minY2, maxX2, maxY2));
 
 	return check;
 
-	//  簢 ġ   ֵ.
+	// 두 사각형이 겹치는지만 알 수 있따.
 	/*
 	{
 		const Vector2D pos1 = square1->GetPos();
@@ -125,15 +238,15 @@ bool Collider::CheckCollisionSquareToSqaure(std::weak_ptr<SquareComponent> b1, s
 		const Vector2D pos2 = square2->GetPos();
 		const Vector2D halfSize2 = square2->GetSize() * 0.5f;
 	
-		//  簢    ū  ã 
+		// 두 사각형의 가장 작은 점과 큰 점을 찾아 비교
 		const Vector2D min1 = pos1 - halfSize1;
 		const Vector2D max1 = pos1 + halfSize1;
 
 		const Vector2D min2 = pos2 - halfSize2;
 		const Vector2D max2 = pos2 + halfSize2;
 
-		//  簢 ¿   ġ κ ٸ
-		//  簢    ġ κ ٸ
+		// 두 사각형의 좌우 변들 중 겹치는 부분이 없다면
+		// 두 사각형의 상하 변들 중 겹치는 부분이 없다면
 		if (max1.X < min2.X || max2.X < min1.X ||  max1.Y < min2.Y || max2.Y < min1.Y)
 			return false;
 	}
@@ -152,49 +265,12 @@ bool Collider::CheckCollisionCircleToSquare(std::weak_ptr<CircleComponent> c1, s
 	if (s == nullptr)
 		return false;
 
-	// 簢 
-	const RECT org = s->GetRect();
-
-	//  
-	const Vector2D circlePos = c->GetPos();
-	const float radius = c->GetRadius();
-
-	bool horizon = org.left <= circlePos.X && circlePos.X <= org.right;
-	bool verticle = org.top <= circlePos.Y && circlePos.Y <= org.bottom;
-	if (horizon || verticle) {
-		//  ŭ Ȯ  ϱ
-		RECT exRect = {
-			org.left - static_cast<LONG>(radius),
-			org.top - static_cast<LONG>(radius),
-			org.right + static_cast<LONG>(radius),
-			org.bottom + static_cast<LONG>(radius),
-		};
-
-		// Ȯ 簢 ȿ  ߽ ִ Ȯ
-		if (exRect.left < circlePos.X && circlePos.X < exRect.right
-			&& exRect.top < circlePos.Y && circlePos.Y < exRect.bottom)
-			return true;
-	}
-	else {
-		Vector2D point = { static_cast<float>(org.left), static_cast<float>(org.top) };
-		// 簢 »  ȿ ִ
-		if (CheckPointInCircle(circlePos, radius, point))
-			return true;
-		// 簢 ϴ  ȿ ִ
-		point.Y = static_cast<float>(org.bottom);
-		if (CheckPointInCircle(circlePos, radius, point))
-			return true;
-		// 簢 ϴ  ȿ ִ
-		point.X = static_cast<float>(org.right);
-		if (CheckPointInCircle(circlePos, radius, point))
-			return true;
-		// 簢   ȿ ִ
-		point.Y = static_cast<float>(org.top);
-		if (CheckPointInCircle(circlePos, radius, point))
-			return true;
-	}
+	const FixedBounds& square = s->GetFixedBounds();
+	const FixedBounds& circle = c->GetFixedBounds();
 
-	return false;
+	// 꼭지점 4개를 검사하는 대신 사각형 위의 가장 가까운 점으로 검사
+	return CollisionUtils::CircleToBox(FixedBounds::ToFloat(circle.centerX), FixedBounds::ToFloat(circle.centerY), FixedBounds::ToFloat(circle.radius),
+		FixedBounds::ToFloat(square.minX), FixedBounds::ToFloat(square.minY), FixedBounds::ToFloat(square.maxX), FixedBounds::ToFloat(square.maxY));
 }
 
 bool Collider::CheckCollisionCircleToCircle(std::weak_ptr<CircleComponent> c1, std::weak_ptr<CircleComponent> c2)
@@ -206,52 +282,91 @@ bool Collider::CheckCollisionCircleToCircle(std::weak_ptr<CircleComponent> c1, s
 	if (circle2 == nullptr)
 		return false;
 
-	const Vector2D pos1 = circle1->GetPos();
-	const float radius1 = circle1->GetRadius();
+	const FixedBounds& bounds1 = circle1->GetFixedBounds();
+	const FixedBounds& bounds2 = circle2->GetFixedBounds();
+
+	// sqrt 없이 거리의 제곱으로 비교
+	return CollisionUtils::CircleToCircle(FixedBounds::ToFloat(bounds1.centerX), FixedBounds::ToFloat(bounds1.centerY), FixedBounds::ToFloat(bounds1.radius),
+		FixedBounds::ToFloat(bounds2.centerX), FixedBounds::ToFloat(bounds2.centerY), FixedBounds::ToFloat(bounds2.radius));
+}
 
-	const Vector2D pos2 = circle2->GetPos();
-	const float radius2 = circle2->GetRadius();
+bool Collider::CheckSweptSquareToSquare(std::weak_ptr<SquareComponent> b1, std::weak_ptr<SquareComponent> b2, float& time, Vector2D& normal)
+{
+	std::shared_ptr<SquareComponent> square1 = b1.lock();
+	if (square1 == nullptr)
+		return false;
+	std::shared_ptr<SquareComponent> square2 = b2.lock();
+	if (square2 == nullptr)
+		return false;
 
-	Vector2D dir = pos1 - pos2;
-	const float dist = dir.Length();
+	// 이전 위치에서 시작, 2번이 멈춰있다고 보고 1번이 상대 이동량만큼 움직인다.
+	const Vector2D pos1 = square1->GetPrevPos();
+	const Vector2D halfSize1 = square1->GetSize() * 0.5f;
+	const Vector2D pos2 = square2->GetPrevPos();
+	const Vector2D halfSize2 = square2->GetSize() * 0.5f;
+	const Vector2D move = (square1->GetPos() - pos1) - (square2->GetPos() - pos2);
 
-	//     Ÿ    պ ũ false, ۰ų  true
-	return dist <= radius1 + radius2;
+	return CollisionUtils::SweptBoxToBox(pos1.X - halfSize1.X, pos1.Y - halfSize1.Y, pos1.X + halfSize1.X, pos1.Y + halfSize1.Y,
+		pos2.X - halfSize2.X, pos2.Y - halfSize2.Y, pos2.X + halfSize2.X, pos2.Y + halfSize2.Y, move.X, move.Y, time, normal);
 }
 
-bool Collider::CheckPointInCircle(const Vector2D& cPos, const float& radius, const Vector2D& point)
+bool Collider::CheckSweptCircleToSquare(std::weak_ptr<CircleComponent> c1, std::weak_ptr<SquareComponent> b1, float& time, Vector2D& normal)
 {
-	Vector2D v = cPos - point;
-	float lengthSq = v.LengthSquared(); //  ߽ɰ   Ÿ
+	std::shared_ptr<CircleComponent> c = c1.lock();
+	if (c == nullptr)
+		return false;
+	std::shared_ptr<SquareComponent> s = b1.lock();
+	if (s == nullptr)
+		return false;
 
-	//  ִٸ
-	if (lengthSq > (radius * radius))
+	const Vector2D squarePos = s->GetPrevPos();
+	const Vector2D halfSize = s->GetSize() * 0.5f;
+	const Vector2D circlePos = c->GetPrevPos();
+	const Vector2D move = (c->GetPos() - circlePos) - (s->GetPos() - squarePos);
+
+	return CollisionUtils::SweptCircleToBox(circlePos.X, circlePos.Y, c->GetRadius(),
+		squarePos.X - halfSize.X, squarePos.Y - halfSize.Y, squarePos.X + halfSize.X, squarePos.Y + halfSize.Y, move.X, move.Y, time, normal);
+}
+
+bool Collider::CheckSweptCircleToCircle(std::weak_ptr<CircleComponent> c1, std::weak_ptr<CircleComponent> c2, float& time, Vector2D& normal)
+{
+	std::shared_ptr<CircleComponent> circle1 = c1.lock();
+	if (circle1 == nullptr)
+		return false;
+	std::shared_ptr<CircleComponent> circle2 = c2.lock();
+	if (circle2 == nullptr)
 		return false;
 
-	return true;
+	const Vector2D pos1 = circle1->GetPrevPos();
+	const Vector2D pos2 = circle2->GetPrevPos();
+	const Vector2D move = (circle1->GetPos() - pos1) - (circle2->GetPos() - pos2);
+
+	return CollisionUtils::SweptCircleToCircle(pos1.X, pos1.Y, circle1->GetRadius(), pos2.X, pos2.Y, circle2->GetRadius(), move.X, move.Y, time, normal);
 }
 
-// Bit 
+// Bit 연산
 /*
-	// bit  : >>, <<, &, |, ^, ~
-	// Ư Ʈ ѱ
+	// bit 연산 : >>, <<, &, |, ^, ~
+	// 특정 비트 켜기
 	flag = flag | (1 << CLT_WALL);
 
-	// Ư Ʈ 
+	// 특정 비트 끄기
 	flag = flag & ~(1 << CLT_WALL);
 
-	// Ʈ üũ
-	bool ret = flag & (1 << CLT_WALL); // &    0 ƴ
+	// 비트 체크
+	bool ret = flag & (1 << CLT_WALL); // & 연산 후 모두 0인지 아닌지
 
-	// ü ѱ
+	// 전체 켜기
 	flag = ~0;
 */
 void Collider::AddCollisionFlagLayer(CollisionLayerType layer)
 {
-	_collisionFlag |= (1 << layer); // Ʈ ѱ
+	_collisionFlag |= layer; // 비트 켜기 (layer 자체가 이미 bit)
+	Wake();
 }
 
 void Collider::RemoveCollisionFlagLayer(CollisionLayerType layer)
 {
-	_collisionFlag &= ~(1 << layer); // Ʈ 
+	_collisionFlag &= ~layer; // 비트 끄기
+	Wake();
 }
@@ -7,10 +7,29 @@ class CircleComponent;
 class Actor;
 
 /*
-	TODO: Overlap Hit 
-		Ignore =  Collider  ƿ 浹 
-		Overlap =  Collider  ϳ bitflag Ű overlap (, ϳ 浹 ϸ)
-		Hit =  Collider   浹   Hit
+	고정 소수점 (1/256 pixel) 충돌 bounds
+		- 1/256 단위의 값은 float로 정확하게 표현되므로 (65536 pixel 안쪽)
+		  float로 바꿔서 계산해도 겹친 크기가 위치나 계산 순서와 상관없이 항상 같다.
+		- 중심과 반 크기를 따로 바꾸므로 같은 크기의 Collider는 어디에 있어도 크기가 같다.
+*/
+struct FixedBounds
+{
+	static constexpr int32 FRACTION_BITS = 8;
+	static constexpr float ONE = static_cast<float>(1 << FRACTION_BITS);
+
+	static int32 ToFixed(float value) { return static_cast<int32>(std::lround(value * ONE)); }
+	static float ToFloat(int32 value) { return static_cast<float>(value) / ONE; }
+
+	int32 minX = 0, minY = 0, maxX = 0, maxY = 0;
+	int32 centerX = 0, centerY = 0;
+	int32 radius = 0; // Square는 0
+};
+
+/*
+	Overlap와 Hit으로 구분 (CollisionLayerTable)
+		Ignore = 두 Collider가 서로 아예 충돌하지 않으면
+		Overlap = 두 Collider 중 하나만 bitflag를 키면 overlap (즉, 하나만 충돌 가능하면)
+		Hit = 두 Collider 모두 서로 충돌할 수 있으면 Hit (BeginOverlap 후 Hit 이벤트도 발생)
 */
 class Collider : public Component, public std::enable_shared_from_this<Collider>
 {
@@ -20,76 +39,145 @@ public:
 
 	virtual void Init() override;
 	virtual void Tick(float DeltaTime) override;
-	virtual void Render(HDC hdc) override;
+	virtual void Render(RenderTarget& target) override;
 
 	virtual void Clear() override;
 
-	// TODO :  Collider  浹Ұ Bit flag Ȱ   ȭ
+	// debug 도형 (선 두께만큼 여유를 둔다)
+	virtual bool GetRenderBounds(RECT& bounds) override;
+
+	// 위치가 바뀌면 bounds를 다시 계산하고 잠든 Collider를 깨운다.
+	virtual void OnMoved() override { _boundsDirty = true; Wake(); }
+
 	virtual bool CheckCollision(std::weak_ptr<Collider> other);
 
-	// ̹ 浹ߴ
-	bool IsCollided(std::shared_ptr<Collider> other) {
-		return _collisionSet.contains(other);
-	}
+	// 이전 Tick 위치에서 현재 위치까지 움직이는 동안 부딪히는지 (빠르게 움직이는 Collider, Projectile)
+	// time = 처음 닿은 시간 (0 ~ 1, 이동한 비율), normal = other에서 자신을 향하는 방향
+	bool CheckSweptCollision(std::weak_ptr<Collider> other, float& time, Vector2D& normal);
+
+	// 두 Collider의 layer와 flag로 정해지는 반응 (Ignore/Overlap/Hit)
+	CollisionResponse GetCollisionResponse(const std::shared_ptr<Collider>& other) const;
+
+	// Broadphase에서 사용할 Collider를 감싸는 사각형 (World 좌표)
+	RECT GetBounds();
+
+	// 충돌 검사용 bounds (위치나 크기가 바뀐 경우에만 다시 계산하고 나머지는 cache를 사용)
+	const FixedBounds& GetFixedBounds();
+
+	// 이미 충돌했는지 (CollisionManager의 pair cache에서 확인)
+	bool IsCollided(std::shared_ptr<Collider> other) const;
 
 	virtual void OnComponentBeginOverlap(std::shared_ptr<Collider> collider, std::shared_ptr<Collider> other);
 	virtual void OnComponentEndOverlap(std::shared_ptr<Collider> collider, std::shared_ptr<Collider> other);
+	virtual void OnComponentHit(std::shared_ptr<Collider> collider, std::shared_ptr<Collider> other);
 
 protected:
-	// TODO: ģ  ϱ https ://blog.naver.com/winterwolfs/10165506488
+	// TODO: 겹친 영역도 계산하기 https ://blog.naver.com/winterwolfs/10165506488
 	bool CheckCollisionSquareToSqaure(std::weak_ptr<SquareComponent> b1, std::weak_ptr<SquareComponent> b2);
 	bool CheckCollisionCircleToSquare(std::weak_ptr<CircleComponent> c1, std::weak_ptr<SquareComponent> b1);
 	bool CheckCollisionCircleToCircle(std::weak_ptr<CircleComponent> c1, std::weak_ptr<CircleComponent> c2);
 
-private:
-	//  ȿ ִ Ȯ
-	bool CheckPointInCircle(const Vector2D& cPos, const float& radius, const Vector2D& point);
+	// 두 Collider 모두 이전 위치 -> 현재 위치로 움직인다. (normal = 2번에서 1번을 향하는 방향)
+	bool CheckSweptSquareToSquare(std::weak_ptr<SquareComponent> b1, std::weak_ptr<SquareComponent> b2, float& time, Vector2D& normal);
+	bool CheckSweptCircleToSquare(std::weak_ptr<CircleComponent> c1, std::weak_ptr<SquareComponent> b1, float& time, Vector2D& normal);
+	bool CheckSweptCircleToCircle(std::weak_ptr<CircleComponent> c1, std::weak_ptr<CircleComponent> c2, float& time, Vector2D& normal);
+
+	// 모양이 바뀌었을때 (크기, 반지름)
+	void OnShapeChanged();
+	// 중심에서 가장자리까지 (Square = size / 2, Circle = radius)
+	virtual Vector2D GetHalfExtent() const { return Vector2D::Zero; }
 
 public:
 	ColliderType GetColliderType() const { return _colliderType; }
 
 	void SetShowDebug(bool show) { _showDebug = show; }
+	// 이 Collider의 설정과 DebugDraw의 DDC_Collider가 모두 켜져 있어야 도형을 그린다.
+	bool IsShowDebug() const;
 
-	void SetCollisionLayer(CollisionLayerType layer) { _collisionLayer = layer; }
+	// layer, flag가 바뀌면 지난 Tick 결과를 그대로 쓸 수 없으므로 깨운다.
+	void SetCollisionLayer(CollisionLayerType layer) { _collisionLayer = layer; Wake(); }
 	CollisionLayerType GetCollisionLayer() const { return _collisionLayer; }
 
-	void SetCollisionFlag(uint8 flag) {	_collisionFlag = flag;	}
+	void SetCollisionFlag(uint8 flag) {	_collisionFlag = flag; Wake(); }
 	uint8 GetCollisionFlag() const { return _collisionFlag;	}
 
-	void ResetCollisionFlag() { _collisionFlag = 0; }
+	void ResetCollisionFlag() { _collisionFlag = 0; Wake(); }
 	void AddCollisionFlagLayer(CollisionLayerType layer);
 	void RemoveCollisionFlagLayer(CollisionLayerType layer);
 
-	void AddCollisionSet(std::shared_ptr<Collider> other) { _collisionSet.insert(other); }
-	void RemoveCollisionSet(std::shared_ptr<Collider> other) { _collisionSet.erase(other); }
-
 	void SetIntersect(Vector2D intersect) { _intersect = intersect;	}
 	Vector2D GetIntersect() const { return _intersect; }
 
-	void SetCollisionEnable() { _enable = true;	}
+	// 이전 collision Tick에서의 위치 (CollisionManager::Tick이 끝날때 저장)
+	void SavePrevPos();
+	Vector2D GetPrevPos() const { return _hasPrevPos ? _prevPos : GetPos(); }
+
+	// 이동 경로로 충돌 검사 (tile 크기보다 빠르게 움직여도 뚫고 지나가지 않는다, Projectile은 항상)
+	void SetContinuous(bool continuous) { _continuous = continuous; }
+	bool IsContinuous() const { return _continuous || _collisionLayer == CLT_Projectile; }
+
+	/*
+		움직이지 않는 Collider
+			- Static : 절대 움직이지 않는 Collider (ex: 벽, 장애물)
+			- Sleep : SLEEP_TICKS 동안 움직이지 않으면 자동으로 잠든다. (위치, 크기, layer가 바뀌면 깨어난다)
+			- 둘 다 움직이지 않는 pair는 검사하지 않고 지난 Tick 결과를 그대로 사용한다.
+	*/
+	void SetStatic(bool isStatic) { _isStatic = isStatic; }
+	bool IsStatic() const { return _isStatic; }
+	bool IsSleeping() const { return _restTicks >= SLEEP_TICKS; }
+	// Static도 깨어난 Tick(처음 등록, 이동, 활성화)에는 한번 검사한다.
+	bool IsResting() const { return (_isStatic && _restTicks > 0) || IsSleeping(); }
+	// wakeNeighbours = 주변에 잠든 Collider도 같이 깨운다.
+	void Wake(bool wakeNeighbours = true);
+
+	// continuous 충돌 중 이번 Tick에 가장 먼저 부딪힌 시간 (0 ~ 1)과 방향
+	void SetImpact(float time, Vector2D normal);
+	float GetImpactTime() const { return _impactTime; }
+	Vector2D GetImpactNormal() const { return _impactNormal; }
+	// 부딪힌 순간의 위치
+	Vector2D GetImpactPos() const;
+
+	// CollisionManager에 등록될때 부여되는 고유 id
+	void SetCollisionId(uint32 id) { _collisionId = id; }
+	uint32 GetCollisionId() const { return _collisionId; }
+
+	void SetCollisionEnable() { _enable = true; Wake(); }
 	void SetCollisionDisable() { _enable = false; }
 	bool GetCollisionEnable() const {
 		return _enable;
 	}
 public:
-	// Collider Component owner object  Manager Ŭ   Ƿ
-	// raw pointer this ص   .
+	// Collider Component는 owner object가 사라질때 Manager 클래스에서 같이 사라지게 했으므로
+	// raw pointer인 this를 사용해도 될 것 같다.
 	Delegate _beginOverlapDelegate;
 	Delegate _endOverlapDelegate;
+	Delegate _hitDelegate;
 
 private:
 	ColliderType _colliderType; 
 	bool _showDebug = true; 
-	// TODO : ̰͵ bit flag ϸ  ?
-	CollisionLayerType _collisionLayer = CLT_Object; // ڽ  (ex: Player, Static, Dynamic etc)
+	// TODO : 이것도 bit flag로 하면 더 좋을까?
+	CollisionLayerType _collisionLayer = CLT_Object; // 자신이 무엇인지 (ex: Player, Static, Dynamic etc)
 
-	//  浹
+	// 누구랑 충돌할지
 	uint8 _collisionFlag = CLT_Object | CLT_Trace;
 
-	// ڽŰ 浹 Collider  (̹ 浹 Collider 浹üũ   ʵ)
-	std::unordered_set<std::shared_ptr<Collider>> _collisionSet;
-
 	Vector2D _intersect = Vector2D::Zero;
 
+	FixedBounds _fixedBounds;
+	bool _boundsDirty = true;
+
+	Vector2D _prevPos = Vector2D::Zero;
+	bool _hasPrevPos = false;
+	bool _continuous = false;
+
+	static constexpr uint32 SLEEP_TICKS = 30;
+	bool _isStatic = false;
+	uint32 _restTicks = 0; // 움직이지 않은 Tick 수
+	float _impactTime = 1.f;
+	Vector2D _impactNormal = Vector2D::Zero;
+
 	bool _enable = true;
+
+	uint32 _collisionId = 0;
 };
@@ -17,6 +17,16 @@ void Component::Tick(float DeltaTime)
 		SetPos(owner->GetPos() + _compPos);
 }
 
+void Component::AddLocalPos(const Vector2D& pos)
+{
+	_compPos = pos;
+	OnMoved();
+
+	// owner가 그리는 영역도 바뀐다.
+	if (std::shared_ptr<Actor> owner = GetOwner())
+		owner->MarkRenderDirty();
+}
+
 Vector2D Component::GetPos() const
 {
 	std::shared_ptr<Actor> owner = GetOwner();
@@ -12,20 +12,26 @@ public:
 
 	virtual void Init() {};
 	virtual void Tick(float DeltaTime);
-	virtual void Render(HDC hdc) {};
+	virtual void Render(RenderTarget& target) {};
 
 	virtual void Clear() {};
 
+	// 그리는 영역 (World 좌표, false = 그리지 않는다)
+	virtual bool GetRenderBounds(RECT& bounds) { return false; }
+
 public: // Getter/Setter
 	void SetOwner(std::weak_ptr<Actor> owner) { _owner = owner; }
-	std::shared_ptr<Actor> GetOwner() const { return _owner.lock(); } //  nullptr
+	std::shared_ptr<Actor> GetOwner() const { return _owner.lock(); } // 없으면 nullptr
 	
-	void AddLocalPos(const Vector2D& pos) { _compPos = pos; }
+	void AddLocalPos(const Vector2D& pos);
+
+	// 자신이나 owner의 위치가 바뀌었을때 (Actor::SetPos)
+	virtual void OnMoved() {}
 
 public:
 	virtual Vector2D GetPos() const override;
 protected:
-	// weak_ptr :  ȯ ذ, ӽ÷ (cache) Ҷ 
+	// weak_ptr : 보통 순환문제 해결, 임시로 데이터(cache) 사용할때 사용
 	std::weak_ptr<Actor> _owner;
 
 	Vector2D _compPos = { 0.f, 0.f };
@@ -3,7 +3,7 @@
 #include "Actor\Actor.h"
 #include "World\World.h"
 #include "Engine.h"
-#include "Utils\WinUtils.h"
+#include "Render\DebugDraw.h"
 #include "CircleComponent.h"
 
 SquareComponent::SquareComponent() : Collider(ColliderType::CT_Square) {}
@@ -20,36 +20,26 @@ void SquareComponent::Tick(float DeltaTime)
 	Super::Tick(DeltaTime);
 }
 
-void SquareComponent::Render(HDC hdc)
+void SquareComponent::Render(RenderTarget& target)
 {
-	Super::Render(hdc);
+	Super::Render(target);
 
-	// 
+	if (IsShowDebug() == false)
+		return;
+
+	// 보정
 	const Vector2D camPos = World::GetCameraPos();
 	Vector2D pos = GetPos();
 	pos -= camPos - Engine::GetScreenSize() * 0.5f;
 
-	::SetDCPenColor(hdc, RGB(255, 0, 0));
-
-	HPEN myPen = (HPEN)::GetStockObject(DC_PEN);
-	HPEN oldPen = (HPEN)::SelectObject(hdc, myPen);
-
-	HBRUSH myBrush = (HBRUSH)::GetStockObject(NULL_BRUSH); // ׸  Handle (NULL_BRUSH θ ä)
-	HBRUSH oldBrush = (HBRUSH)::SelectObject(hdc, myBrush);
-	
-	::SetDCPenColor(hdc, RGB(255, 0, 0));
-	
-	WinUtils::DrawRect(hdc, pos, static_cast<int32>(_size.X), static_cast<int32>(_size.Y));
-	::SelectObject(hdc, oldBrush);
-	::DeleteObject(myBrush);
-
-	::SelectObject(hdc, oldPen);
-	::DeleteObject(myPen);
+	const int32 w = static_cast<int32>(_size.X);
+	const int32 h = static_cast<int32>(_size.Y);
+	DEBUG_DRAW_RECT(DDC_Collider, static_cast<int32>(pos.X - w / 2), static_cast<int32>(pos.Y - h / 2), static_cast<int32>(pos.X + w / 2), static_cast<int32>(pos.Y + h / 2), RGB(255, 0, 0));
 }
 
 bool SquareComponent::CheckCollision(std::weak_ptr<Collider> other)
 {
-	if (Super::CheckCollision(other) == false) //  浹  ִ Ȯ
+	if (Super::CheckCollision(other) == false) // 서로 충돌할 수 있는지 확인
 		return false;
 
 	std::shared_ptr<Collider> collider = other.lock();
@@ -67,18 +57,3 @@ bool SquareComponent::CheckCollision(std::weak_ptr<Collider> other)
 	}
 	return false;
 }
-
-RECT SquareComponent::GetRect()
-{
-	Vector2D pos = GetPos();
-	Vector2D halfSize = GetSize() * 0.5f;
-
-	RECT rect = {
-		static_cast<int32>(pos.X - halfSize.X),
-		static_cast<int32>(pos.Y - halfSize.Y),
-		static_cast<int32>(pos.X + halfSize.X),
-		static_cast<int32>(pos.Y + halfSize.Y)
-	};
-
-	return rect;
-}
@@ -7,15 +7,16 @@ class SquareComponent : public Collider
 public:
 	virtual void Init() override;
 	virtual void Tick(float DeltaTime) override;
-	virtual void Render(HDC hdc) override;
+	virtual void Render(RenderTarget& target) override;
 
 	virtual bool CheckCollision(std::weak_ptr<Collider> other);
 
 public:
-	void SetSize(Vector2D size) {	_size = size;}
+	void SetSize(Vector2D size) {	_size = size; OnShapeChanged(); }
 	Vector2D GetSize() const {	return _size;}
 
-	RECT GetRect();
+protected:
+	virtual Vector2D GetHalfExtent() const override { return _size * 0.5f; }
 private:
 	Vector2D _size = Vector2D::Zero;
 };
@@ -3,6 +3,8 @@
 #include "World\World.h"
 #include "Manager\InputManager.h"
 #include "Manager\AssetManager.h"
+#include "Render\FrameBuffer.h"
+#include "Render\DirtyRegion.h"
 
 Engine::Engine() : EngineWindow()
 {
@@ -31,5 +33,18 @@ void Engine::Tick()
 
 void Engine::Render()
 {
-	_world->Render(_hdcBack);
+	// 카메라가 움직이면 화면 전체가 바뀐다. (비교할 필요 없이 전체를 다시 그린다)
+	const Vector2D cameraPos = World::GetCameraPos();
+	if (cameraPos != _lastCameraPos) {
+		_lastCameraPos = cameraPos;
+		MarkFullRedraw();
+	}
+
+	_world->Render(_dirtyRenderer->BeginFrame(_renderTarget->GetWidth(), _renderTarget->GetHeight()));
+
+	// CPU FrameBuffer는 tile로 나눠 여러 thread에서 그린다.
+	if (GetRenderBackend() == RenderBackend::RB_Software)
+		_dirtyRenderer->EndFrame(static_cast<FrameBuffer&>(*_renderTarget), RGB(255, 255, 255));
+	else
+		_dirtyRenderer->EndFrame(*_renderTarget, RGB(255, 255, 255));
 }
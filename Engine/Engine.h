@@ -18,5 +18,6 @@ public:
 	Engine& GetEngine() { return *this; }
 private:
 	std::unique_ptr<World> _world;
+	Vector2D _lastCameraPos = {};
 };
 
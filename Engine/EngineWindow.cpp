@@ -1,5 +1,8 @@
 #include "pch.h"
 #include "EngineWindow.h"
+#include "Render\GdiRenderTarget.h"
+#include "Render\FrameBuffer.h"
+#include "Render\DirtyRegion.h"
 
 EngineWindow* win = nullptr;
 
@@ -13,6 +16,7 @@ LRESULT CALLBACK WndProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam) {
 EngineWindow::EngineWindow()
 {
 	win = this;
+	_dirtyRenderer = std::make_unique<DirtyRectRenderer>();
 }
 
 EngineWindow::~EngineWindow()
@@ -22,11 +26,11 @@ EngineWindow::~EngineWindow()
 
 bool EngineWindow::InitWin(HINSTANCE& hInstance, int& nCmdShow)
 {
-    // 1)  â  
+    // 1) 윈도우 창 정보 등록
     if (!RegisterWindowClass(hInstance))
         return false;
 
-    // 2)  â 
+    // 2) 윈도우 창 생성
     // Perform application initialization:
     if (!InitInstance(hInstance, nCmdShow))
         return false;
@@ -36,6 +40,16 @@ bool EngineWindow::InitWin(HINSTANCE& hInstance, int& nCmdShow)
     return true;
 }
 
+void EngineWindow::SetDirtyRects(bool enabled)
+{
+    _dirtyRenderer->SetEnabled(enabled);
+}
+
+void EngineWindow::MarkFullRedraw()
+{
+    _dirtyRenderer->MarkFullRedraw();
+}
+
 bool EngineWindow::RegisterWindowClass(HINSTANCE hInstance)
 {
     WNDCLASSEXW wcex;
@@ -43,7 +57,7 @@ bool EngineWindow::RegisterWindowClass(HINSTANCE hInstance)
     wcex.cbSize = sizeof(WNDCLASSEX);
 
     wcex.style = CS_HREDRAW | CS_VREDRAW;
-    wcex.lpfnWndProc = WndProc; // ̺Ʈ ó  Լ 
+    wcex.lpfnWndProc = WndProc; // 이벤트를 처리할 일종의 함수 포인터
     wcex.cbClsExtra = 0;
     wcex.cbWndExtra = 0;
     wcex.hInstance = hInstance;
@@ -54,7 +68,7 @@ bool EngineWindow::RegisterWindowClass(HINSTANCE hInstance)
     wcex.lpszClassName = L"Engine";
     wcex.hIconSm = LoadIcon(wcex.hInstance, MAKEINTRESOURCE(108));
 
-    //  Ŭ 
+    // 윈도우 클래스 등록
     return ::RegisterClassExW(&wcex);
 }
 
@@ -62,11 +76,11 @@ bool EngineWindow::InitInstance(HINSTANCE hInstance, int nCmdShow)
 {
     _hInst = hInstance; // Store instance handle in our global variable
 
-    //  ޴ٸ ϰ ĵ  
+    // 윈도우 메뉴바를 제외하고 캔버스 사이즈를 지정
     RECT windowRect = { 0, 0, _screenWidth, _screenHeight };
     ::AdjustWindowRect(&windowRect, WS_OVERLAPPEDWINDOW, false);
 
-    //   Ŭ â 
+    // 등록한 윈도우 클래스로 윈도우창 생성
     HWND hWnd = ::CreateWindowW(L"Engine", L"Client", WS_OVERLAPPEDWINDOW,
         1480, 370, windowRect.right - windowRect.left, windowRect.bottom - windowRect.top, nullptr, nullptr, hInstance, nullptr);
 
@@ -93,31 +107,38 @@ void EngineWindow::SetDoubleBuffering(HWND hWnd)
 {
     _hdc = ::GetDC(hWnd);
 
-    //  â ĵ ũ
+    // 윈도우 창 캔버스 크기
     ::GetClientRect(hWnd, &_rect);
 
-    // _hdc ȣȯǴ DC  
+    // _hdc와 호환되는 DC 생성 
     _hdcBack = ::CreateCompatibleDC(_hdc);
-    // _hdc ȣȯǴ Ʈ 
+    // _hdc와 호환되는 비트맵 생성
     _bmpBack = ::CreateCompatibleBitmap(_hdc, _rect.right, _rect.bottom);
-    // DC BMP 
+    // DC와 BMP 연결
     HBITMAP prev = static_cast<HBITMAP>(::SelectObject(_hdcBack, _bmpBack));
-    ::DeleteObject(prev); //  BitMap 
+    ::DeleteObject(prev); // 이전 BitMap 삭제
+
+    if (_renderBackend == RenderBackend::RB_Software)
+        _renderTarget = std::make_unique<FrameBuffer>(_rect.right, _rect.bottom);
+    else
+        _renderTarget = std::make_unique<GdiRenderTarget>(_hdcBack, _rect.right, _rect.bottom);
+    _renderTarget->Clear(RGB(255, 255, 255));
+    _dirtyRenderer->MarkFullRedraw();
 }
 
 int EngineWindow::Run()
 {
     MSG msg = {};
 
-    // 3)  
-    //  - Է
-    //  - 
-    //  - 
+    // 3) 메인 루프
+    //  - 입력
+    //  - 로직
+    //  - 렌더링
     // 
     // Main message loop:
     while (msg.message != WM_QUIT)
     {
-        // Message Event ó (msg )
+        // Message Event 처리 (msg가 있을때만)
         if (::PeekMessage(&msg, NULL, 0, 0, PM_REMOVE)) {
             ::TranslateMessage(&msg);
             ::DispatchMessage(&msg);
@@ -138,9 +159,32 @@ int EngineWindow::Run()
 
 void EngineWindow::DoubleBuffering()
 {
-    // BitBlt(BitBullet) :   (memcpy )
-    ::BitBlt(_hdc, 0, 0, _rect.right, _rect.bottom, _hdcBack, 0, 0, SRCCOPY); // render
-    ::PatBlt(_hdcBack, 0, 0, _rect.right, _rect.bottom, WHITENESS); // remove   
+    // Render에서 다시 그린 영역만 창에 복사 (back buffer는 지우지 않고 다음 frame에서 바뀐 곳만 다시 그린다)
+    for (const RECT& rect : _dirtyRenderer->GetDirtyRegion().GetRects()) {
+        const int32 width = rect.right - rect.left;
+        const int32 height = rect.bottom - rect.top;
+
+        if (_renderBackend == RenderBackend::RB_Software) {
+            // FrameBuffer는 32bit top-down DIB와 같은 배치라 그대로 창에 복사
+            // rect의 줄만 DIB 하나로 넘긴다. (top-down DIB의 일부 줄만 복사할 때 시작 줄이 헷갈리지 않도록)
+            FrameBuffer& frameBuffer = static_cast<FrameBuffer&>(*_renderTarget);
+
+            BITMAPINFO info = {};
+            info.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+            info.bmiHeader.biWidth = frameBuffer.GetWidth();
+            info.bmiHeader.biHeight = -height;
+            info.bmiHeader.biPlanes = 1;
+            info.bmiHeader.biBitCount = 32;
+            info.bmiHeader.biCompression = BI_RGB;
+
+            const uint32* rows = frameBuffer.GetPixels() + static_cast<size_t>(rect.top) * frameBuffer.GetWidth();
+            ::SetDIBitsToDevice(_hdc, rect.left, rect.top, width, height, rect.left, 0, 0, height, rows, &info, DIB_RGB_COLORS); // render
+        }
+        else {
+            // BitBlt(BitBullet) : 고속 복사 (memcpy와 같다)
+            ::BitBlt(_hdc, rect.left, rect.top, width, height, _hdcBack, rect.left, rect.top, SRCCOPY); // render
+        }
+    }
 }
 
 LRESULT EngineWindow::WinProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
@@ -165,22 +209,26 @@ LRESULT EngineWindow::WinProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam
         if ((wParam & 0xfff0) == SC_KEYMENU) // Disable ALT application menu
             return 0;
         break;
-    case WM_PAINT: // render (WM_PAINT   ׷ش.)
+    case WM_PAINT: // render (WM_PAINT는 한 번만 그려준다.)
     {
         PAINTSTRUCT ps;
-        //  ĺȣ
+        // 일종의 식별번호
         HDC hdc = ::BeginPaint(hWnd, &ps); // hdc = handle device context
 
+        // 창이 가려졌다 다시 보이면 다음 frame에서 전체를 다시 복사
+        if (_dirtyRenderer)
+            _dirtyRenderer->MarkFullRedraw();
+
         ::EndPaint(hWnd, &ps);
     }
     break;
     case WM_KEYDOWN:
-        // ESC  α׷ 
+        // ESC 누르면 프로그램 종료
         if (wParam == 27)
             DestroyWindow(hWnd);
         break;
-    case WM_MOUSEMOVE: // 콺 ǥ
-        // int lParam 32bit  16bit x,  16bit y 
+    case WM_MOUSEMOVE: // 마우스 좌표
+        // int lParam인 32bit에서 뒤 16bit는 x값, 앞 16bit는 y값으로 사용
         // lParam & 0xFFFF;
         _mousePosX = LOWORD(lParam);
         // (lParam >> 16) & 0xFFFF;
@@ -1,4 +1,8 @@
 #pragma once
+
+class RenderTarget;
+class DirtyRectRenderer;
+
 class EngineWindow
 {
 public:
@@ -13,6 +17,15 @@ public:
 	virtual void Tick() = 0;
 	virtual void Render() = 0;
 
+	// InitWin 전에 설정
+	void SetRenderBackend(RenderBackend backend) { _renderBackend = backend; }
+	RenderBackend GetRenderBackend() const { return _renderBackend; }
+
+	// false = 매 frame 전체를 지우고 다시 그린다. (기본 = 바뀐 영역만)
+	void SetDirtyRects(bool enabled);
+	// 다음 frame은 화면 전체를 다시 그린다. (카메라 이동, 창이 가려졌다 보일때)
+	void MarkFullRedraw();
+
 	void SetWindowSize(const int32& width, const int32& height) { 
 		_screenWidth = width; 
 		_screenHeight = height;
@@ -33,10 +46,10 @@ public:
 	int32 GetMouseX() const { return _mousePosX; }
 	int32 GetMouseY() const { return _mousePosY; }
 private:
-	// 1)  â  
+	// 1) 윈도우 창 정보 등록
 	bool RegisterWindowClass(HINSTANCE hInstance);
 
-	// 2)  â 
+	// 2) 윈도우 창 생성
 	// Perform application initialization:
 	bool InitInstance(HINSTANCE hInstance, int nCmdShow);
 	void SetDoubleBuffering(HWND hWnd);
@@ -44,20 +57,26 @@ private:
 
 protected:
 	/*
-		HINSTANCE = ڵ νϽ, α׷ νϽ ĺ,   α׷ ü üȭ ּ.
-		 = HINSTANCE α׷ ü ڵ̸ , HWND α׷ â ȣ
+		HINSTANCE = 핸들 인스턴스, 프로그램의 인스턴스 식별자, 쉽게 보면 프로그램 자체의 실체화된 주소.
+		결론 = HINSTANCE는 프로그램 자체의 핸들이며 , HWND는 프로그램안의 윈도우창의 번호
 	*/
 	HINSTANCE _hInst = {};
-	//  ڵ (â ڵ ȣ)
+	// 윈도우 핸들 (윈도우창의 핸들 번호)
 	HWND _hwnd = {};
-	// DC ¿ ʿ     (ǥ,  )
-	// HDC DC  ϴ  ü ޸ ּҸ Ű 
-	HDC _hdc = {}; // ⼭ 
+	// DC는 출력에 필요한 정보를 가지는 데이터 구조 (좌표, 색 등)
+	// HDC는 DC의 정보를 저장하는 데이터 구조체의 메모리 주소를 가르키는 값
+	HDC _hdc = {}; // 여기서 렌더링
 	// Double Buffering
 	RECT _rect = {};
-	HDC _hdcBack = {}; // ⿡ ׸
+	HDC _hdcBack = {}; // 여기에 그리기
 	HBITMAP _bmpBack = {};
 
+	// Level, Actor, Component는 여기에 그린다. (GDI = _hdcBack, Software = CPU FrameBuffer)
+	RenderBackend _renderBackend = RenderBackend::RB_Gdi;
+	std::unique_ptr<RenderTarget> _renderTarget;
+	// Render는 여기서 받은 RenderTarget에 그리고, 바뀐 영역만 _renderTarget에 반영해서 창에 복사한다.
+	std::unique_ptr<DirtyRectRenderer> _dirtyRenderer;
+
 	int32 _mousePosX = 0;
 	int32 _mousePosY = 0;
 
@@ -17,4 +17,17 @@ public:									\
 	using Super = parent;					\
 public:										\
 	className();							\
-	virtual ~className() override;					
\ No newline at end of file
+	virtual ~className() override;					
+
+/*
+	DebugDraw (Render\DebugDraw.h)
+		- 0이면 DebugDraw를 빌드에서 뺀다. (DEBUG_DRAW_* 호출은 인자도 계산하지 않는다)
+		- 배포 빌드는 전처리기 정의에 SHIPPING을 추가한다.
+*/
+#ifndef USE_DEBUG_DRAW
+#ifdef SHIPPING
+#define USE_DEBUG_DRAW 0
+#else
+#define USE_DEBUG_DRAW 1
+#endif
+#endif
@@ -26,5 +26,5 @@ namespace fs = std::filesystem;
 #include "Headers\Defines.h"
 #include "Headers\InputStates.h"
 
-// TransparentBlt 
+// TransparentBlt, AlphaBlend 사용
 #pragma comment(lib, "msimg32.lib")
\ No newline at end of file
@@ -1,6 +1,6 @@
 #pragma once
 
-// enum class ƴϹǷ intε  
+// enum class가 아니므로 int로도 사용 가능
 enum LayerType {
 	LT_BACKGROUND,
 	LT_OBJECT,
@@ -29,12 +29,53 @@ enum class ActionState {
 	AS_Attack,
 };
 
+// 화면을 그리는 방법
+enum class RenderBackend {
+	RB_Gdi,			// GDI (HDC에 TransparentBlt, Rectangle 등)
+	RB_Software		// CPU FrameBuffer에 그리고 창에는 한번에 복사
+};
+
 enum class ColliderType {
 	CT_Square,
 	CT_Circle
 };
 
-// TODO: C++ Bitmask enum class Ȱ Ҷ
+// batch 함수(CollisionUtils, BlitUtils)가 사용하는 SIMD 명령어 (CpuFeatures)
+enum class SimdLevel : uint8 {
+	SL_Scalar,
+	SL_Sse,		// SSE2, 4개씩
+	SL_Avx2		// AVX2, 8개씩
+};
+
+// 충돌 후보(pair)를 찾는 방법
+enum class BroadphaseType {
+	BP_SpatialHash,		// 격자 기반, 매 Tick 새로 구성
+	BP_SweepAndPrune	// 정렬된 endpoint 기반, 이전 Tick 결과를 재사용
+};
+
+// CollisionManager가 한 Tick 동안 모아뒀다 발생시키는 이벤트
+enum class CollisionEventType : uint8 {
+	CET_BeginOverlap,
+	CET_EndOverlap,
+	CET_Hit
+};
+
+// 두 Collider가 서로 만났을 때의 반응
+enum class CollisionResponse : uint8 {
+	CR_Ignore,	// 둘 다 상대 layer를 flag로 가지지 않으면 아예 충돌하지 않는다
+	CR_Overlap,	// 하나만 상대 layer를 flag로 가지면 Overlap
+	CR_Hit		// 둘 다 서로의 layer를 flag로 가지면 Hit
+};
+
+// DebugDraw로 그리는 것의 종류 (종류별로 켜고 끌 수 있다)
+enum DebugDrawCategory : uint32 {
+	DDC_Collider = (1u << 0),	// Collider 도형
+	DDC_Stats = (1u << 1),		// 화면 왼쪽 위의 Mouse, FPS, Collision, Render 정보
+
+	DDC_All = 0xFFFFFFFFu
+};
+
+// TODO: C++의 Bitmask를 enum class를 활용해 사용할때
 // https://stackoverflow.com/questions/12059774/c11-standard-conformant-bitmasks-using-enum-class
 // https://voithos.io/articles/enum-class-bitmasks/
 // https://walbourn.github.io/modern-c++-bitmask-types/
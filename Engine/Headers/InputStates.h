@@ -1,6 +1,6 @@
 #pragma once
 
-// WinAPI ǵִ°   ϰ
+// WinAPI에 정의되있는걸 좀더 쓰기 편하게
 enum class KeyType
 {
 	LeftMouse = VK_LBUTTON,
@@ -13,6 +13,9 @@ enum class KeyType
 	SpaceBar = VK_SPACE,
 	LCtrl = VK_LCONTROL,
 
+	F1 = VK_F1,
+	F2 = VK_F2,
+
 	KEY_1 = '1',
 	KEY_2 = '2',
 	KEY_3 = '3',
@@ -17,17 +17,23 @@ void AssetManager::Init(HWND hwnd)
 
 bool AssetManager::LoadTexture(const std::wstring& key, const std::wstring& path, uint32 transparent)
 {
-	// ̹ Ǿ ִٸ
+	// 이미 생생되어 있다면
 	if (_textures.find(key) != _textures.end())
 		return true;
 	
 	fs::path fullPath = _resourcePath / path;
 
+	// Load하면서 transparent로 구간(ColorKeySpans)을 구하므로 먼저 설정
 	std::shared_ptr<Texture> texture = std::make_shared<Texture>();
-	if (!texture->LoadBmp(_hwnd, fullPath.c_str()))
+	texture->SetTransparent(transparent);
+
+	// BMP가 아니면 WIC (PNG는 alpha를 사용하므로 transparent는 무시된다)
+	std::wstring extension = fullPath.extension().wstring();
+	std::transform(extension.begin(), extension.end(), extension.begin(), ::towlower);
+	const bool loaded = extension == L".bmp" ? texture->LoadBmp(_hwnd, fullPath.c_str()) : texture->LoadPng(_hwnd, fullPath.c_str());
+	if (!loaded)
 		return false;
 
-	texture->SetTransparent(transparent);
 	_textures[key] = std::move(texture);
 
 	return true;
@@ -5,27 +5,31 @@ class Sprite;
 class Flipbook;
 class Tilemap;
 
-// Asset ѹ Load  ؼ 
+// Asset은 한번 Load한 뒤 공유해서 사용
 class AssetManager
 {
 	GENERATE_SINGLE(AssetManager)
 public:
 	~AssetManager();
 	void Init(HWND hwnd);
+	// 창이 없으면 nullptr (Texture를 직접 만들때 사용)
+	HWND GetHwnd() const { return _hwnd; }
 
 	void SetResourcePath(fs::path& path) { _resourcePath = path; }
 	fs::path& GetResourcePath() { return _resourcePath; }
 
 
 public:
+	// .bmp 외의 형식(.png 등)은 WIC로 읽고 alpha를 사용한다.
 	bool LoadTexture(const std::wstring& key, const std::wstring& path, uint32 transparent = RGB(255, 0, 255) /* Default = RGB(255, 0, 255)*/);
 	// TODO: shared_ptr vs weak_ptr?
 	std::shared_ptr<Texture> GetTexture(const std::wstring& key);
+	const std::unordered_map<std::wstring, std::shared_ptr<Texture>>& GetTextures() const { return _textures; }
 
 	std::shared_ptr<Sprite> CreateSprite(const std::wstring& key, std::shared_ptr<Texture> texture, Vector2D pos = Vector2D::Zero, Vector2D size = Vector2D::Zero);
 	std::shared_ptr<Sprite> GetSprite(const std::wstring& key);
 
-	// TODO: setinfo ʿ 뵵  ޱ
+	// TODO: setinfo에 필요한 내용도 같이 받기
 	std::shared_ptr<Flipbook> CreateFlipbook(const std::wstring& key);
 	std::shared_ptr<Flipbook> GetFlipbook(const std::wstring& key);
 
@@ -35,7 +39,7 @@ public:
 	std::shared_ptr<Tilemap> GetTilemap(const std::wstring& key);
 
 private:
-	HWND _hwnd;
+	HWND _hwnd = nullptr;
 	fs::path _resourcePath;
 
 	std::unordered_map<std::wstring, std::shared_ptr<Texture>> _textures;
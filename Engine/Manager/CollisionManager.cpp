@@ -1,6 +1,10 @@
 #include "pch.h"
 #include "CollisionManager.h"
 #include "Component\Collider.h"
+#include "Collision\SpatialHashGrid.h"
+#include "Collision\SweepAndPrune.h"
+#include "Utils\CollisionUtils.h"
+#include "ThreadManager.h"
 
 CollisionManager::~CollisionManager()
 {
@@ -10,45 +14,431 @@ CollisionManager::~CollisionManager()
 
 void CollisionManager::Init()
 {
+	SetBroadphase(_broadphaseType);
 }
 
 void CollisionManager::Tick()
 {
-	std::vector<std::shared_ptr<Collider>>& colliders = _colliders;
+	// Overlap 이벤트 안에서 Actor가 지워지면 _colliders가 바뀌므로 복사해서 사용
+	std::vector<std::shared_ptr<Collider>> colliders = _colliders;
 
-	for (int32 i = 0; i < colliders.size(); ++i) {
-		std::shared_ptr<Collider> src = colliders[i];
+	if (_broadphase == nullptr)
+		SetBroadphase(_broadphaseType);
 
-		for (int32 j = i + 1; j < colliders.size(); ++j) {
-			std::shared_ptr<Collider> dest = colliders[j];
+	// 지난 Tick 데이터로 깨어난 Collider 주변을 찾아야 하므로 Build 전에
+	WakeNeighbours();
 
-			// 浹ߴ Ȯ
-			if (src->CheckCollision(dest)) {
-				if (src->IsCollided(dest) == false) {
-					src->OnComponentBeginOverlap(src, dest);
-					dest->OnComponentBeginOverlap(dest, src);
+	// Component의 위치, 크기 등을 한번에 배열로 복사
+	_arrays.Build(colliders);
 
-					src->AddCollisionSet(dest); //  浹  ߰
-					dest->AddCollisionSet(src);
-				}
+	// 충돌할 수 없는 layer끼리는 Broadphase에서부터 pair를 만들지 않는다.
+	BuildLayerTable();
+
+	// Broadphase : 충돌 가능성이 있는 pair만 검사
+	_pairs.clear();
+	_broadphase->FindPairs(_arrays, _layerTable, _pairs);
+
+	// row -> colliders index (row는 colliders 순서대로 만들었으므로 정렬 순서는 그대로)
+	for (CollisionPair& pair : _pairs) {
+		pair.src = _arrays.owners[pair.src];
+		pair.dest = _arrays.owners[pair.dest];
+	}
+
+	_stats = {};
+	_stats.colliderCount = static_cast<int32>(colliders.size());
+	_stats.pairsTested = static_cast<int32>(_pairs.size());
+
+	// 모든 pair를 먼저 검사 (pair가 많으면 여러 thread에서 나눠서)
+	RunNarrowphase();
+
+	// 이번 Tick 충돌한 pair (task 순서대로 합치면 pair 순서와 같다)
+	_hits.clear();
+	for (const NarrowphaseTask& task : _tasks) {
+		int32 swept = 0;
+		for (int32 i : task.hits) {
+			const CollisionPair& pair = _pairs[i];
+			const int32 a = _arrays.rows[pair.src];
+			const int32 b = _arrays.rows[pair.dest];
+
+			// 이동 경로로 부딪힌 경우 처음 닿은 시간과 방향을 양쪽에 저장 (task에서 검사한 결과)
+			if (_arrays.continuous[a] || _arrays.continuous[b]) {
+				const NarrowphaseTask::SweptHit& hit = task.sweptHits[swept++];
+				assert(hit.pair == i);
+				colliders[pair.src]->SetImpact(hit.time, hit.normal);
+				colliders[pair.dest]->SetImpact(hit.time, -hit.normal);
 			}
-			else {
-				//  浿ߴ ̻ 浹 ʴ´ٸ
-				if (src->IsCollided(dest)) {
-					src->OnComponentEndOverlap(src, dest);
-					dest->OnComponentEndOverlap(dest, src);
-
-					src->RemoveCollisionSet(dest);
-					dest->RemoveCollisionSet(src);
-				}
+
+			// Square끼리는 겹친 만큼 src에 저장 (GameActor에서 밀어낼때 사용, 지나쳐서 겹치지 않으면 제외)
+			if (_arrays.types[a] == ColliderType::CT_Square && _arrays.types[b] == ColliderType::CT_Square && CollisionUtils::TestOverlap(_arrays, a, b))
+				colliders[pair.src]->SetIntersect(CollisionUtils::GetPenetration(_arrays, a, b));
+
+			_hits.push_back(ContactPairCache::MakeKey(_arrays.ids[a], _arrays.ids[b]));
+		}
+	}
+	// 서로 움직이지 않은 pair는 Broadphase에서 만들지 않으므로 지난 Tick 결과를 그대로 사용
+	KeepRestingContacts();
+	_stats.pairsHit = static_cast<int32>(_hits.size());
+
+	// id는 colliders 순서대로 커지므로 보통 이미 정렬되어 있다.
+	if (std::is_sorted(_hits.begin(), _hits.end()) == false)
+		std::sort(_hits.begin(), _hits.end());
+
+	// 이전 Tick과 비교해 새로 충돌한 pair는 Begin, 더 이상 충돌하지 않는 pair는 End
+	_contactCache.Update(_hits, _contactChanges);
+
+	// 검사가 모두 끝난 뒤 이벤트를 한번에 발생
+	// 이벤트 안에서 Actor를 지워도(Level::RemoveActor) 검사 중인 데이터에는 영향이 없다.
+	RecordEvents();
+	DispatchEvents(colliders);
+
+	// 다음 Tick의 Swept 검사는 지금 위치에서 시작
+	for (std::shared_ptr<Collider>& collider : colliders)
+		collider->SavePrevPos();
+}
+
+void CollisionManager::WakeNeighbours()
+{
+	if (_wakeRequests.empty())
+		return;
+
+	// 깨어난 Collider가 지난 Tick에 있던 자리와 겹치는 Collider들
+	for (uint32 id : _wakeRequests) {
+		const int32 row = _arrays.FindRow(id);
+		if (row < 0)
+			continue;
+
+		_queryRows.clear();
+		_broadphase->Query(_arrays, _arrays.GetBounds(row), _queryRows);
+		for (int32 other : _queryRows) {
+			const int32 index = FindColliderIndex(_colliders, _arrays.ids[other]);
+			if (index >= 0)
+				_colliders[index]->Wake(false);
+		}
+	}
+
+	_wakeRequests.clear();
+}
+
+void CollisionManager::KeepRestingContacts()
+{
+	int32 restingCount = 0;
+	for (uint8 resting : _arrays.resting)
+		restingCount += resting;
+	_stats.resting = restingCount;
+
+	if (restingCount < 2)
+		return;
+
+	for (uint64 key : _contactCache.GetContacts()) {
+		const int32 a = _arrays.FindRow(ContactPairCache::GetFirstId(key));
+		const int32 b = _arrays.FindRow(ContactPairCache::GetSecondId(key));
+		if (a < 0 || b < 0 || _arrays.resting[a] == 0 || _arrays.resting[b] == 0)
+			continue;
+
+		_hits.push_back(key);
+	}
+}
+
+void CollisionManager::RecordEvents()
+{
+	_events.clear();
+
+	for (const ContactChange& change : _contactChanges) {
+		const uint32 srcId = ContactPairCache::GetFirstId(change.key);
+		const uint32 destId = ContactPairCache::GetSecondId(change.key);
+
+		if (change.begin == false) {
+			_events.push_back({ CollisionEventType::CET_EndOverlap, srcId, destId });
+			continue;
+		}
+
+		_events.push_back({ CollisionEventType::CET_BeginOverlap, srcId, destId });
+
+		// 서로 상대 layer와 충돌하도록 설정했다면 Hit 이벤트도 발생 (Begin 다음)
+		const int32 a = _arrays.FindRow(srcId);
+		const int32 b = _arrays.FindRow(destId);
+		if (CollisionLayerTable::GetResponse(_arrays.layers[a], _arrays.flags[a], _arrays.layers[b], _arrays.flags[b]) == CollisionResponse::CR_Hit)
+			_events.push_back({ CollisionEventType::CET_Hit, srcId, destId });
+	}
+
+	_stats.events = static_cast<int32>(_events.size());
+}
+
+void CollisionManager::DispatchEvents(const std::vector<std::shared_ptr<Collider>>& colliders)
+{
+	// 앞의 이벤트에서 제거된 Collider는 더 이상 이벤트를 받지 않는다.
+	auto isRegistered = [this](const CollisionEvent& event) {
+		return FindColliderIndex(_colliders, event.srcId) >= 0 && FindColliderIndex(_colliders, event.destId) >= 0;
+	};
+
+	for (const CollisionEvent& event : _events) {
+		if (isRegistered(event) == false)
+			continue;
+
+		// colliders는 Tick 시작때 복사해둔 것이므로 제거됐더라도 여기서는 살아있다.
+		std::shared_ptr<Collider> src = colliders[FindColliderIndex(colliders, event.srcId)];
+		std::shared_ptr<Collider> dest = colliders[FindColliderIndex(colliders, event.destId)];
+
+		switch (event.type)
+		{
+		case CollisionEventType::CET_BeginOverlap:
+			src->OnComponentBeginOverlap(src, dest);
+			if (isRegistered(event))
+				dest->OnComponentBeginOverlap(dest, src);
+			break;
+		case CollisionEventType::CET_EndOverlap:
+			src->OnComponentEndOverlap(src, dest);
+			if (isRegistered(event))
+				dest->OnComponentEndOverlap(dest, src);
+			break;
+		case CollisionEventType::CET_Hit:
+			src->OnComponentHit(src, dest);
+			if (isRegistered(event))
+				dest->OnComponentHit(dest, src);
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+bool CollisionManager::IsCollided(const Collider* a, const Collider* b) const
+{
+	return _contactCache.Contains(a->GetCollisionId(), b->GetCollisionId());
+}
+
+int32 CollisionManager::FindColliderIndex(const std::vector<std::shared_ptr<Collider>>& colliders, uint32 id) const
+{
+	// AddCollider에서 id를 순서대로 부여하고 제거해도 순서는 유지되므로 id로 정렬된 상태
+	auto it = std::lower_bound(colliders.begin(), colliders.end(), id, [](const std::shared_ptr<Collider>& collider, uint32 id) {
+		return collider->GetCollisionId() < id;
+	});
+
+	if (it == colliders.end() || (*it)->GetCollisionId() != id)
+		return -1;
+	return static_cast<int32>(it - colliders.begin());
+}
+
+void CollisionManager::RunNarrowphase()
+{
+	_results.assign(_pairs.size(), 0);
+
+	// pair가 적으면 thread를 깨우는 비용이 더 크므로 나누지 않는다.
+	const int32 pairCount = static_cast<int32>(_pairs.size());
+	const int32 maxTaskCount = GET_SINGLE(ThreadManager)->GetThreadCount() * 4;
+	const int32 taskCount = std::clamp(pairCount / MIN_PAIRS_PER_TASK, 1, maxTaskCount);
+
+	_tasks.resize(taskCount);
+	for (int32 i = 0; i < taskCount; ++i) {
+		_tasks[i].begin = static_cast<int32>(static_cast<int64>(pairCount) * i / taskCount);
+		_tasks[i].end = static_cast<int32>(static_cast<int64>(pairCount) * (i + 1) / taskCount);
+	}
+	_stats.tasks = taskCount;
+
+	// 각 task는 자기 범위의 _results와 자기 데이터만 쓰므로 lock이 필요없다.
+	GET_SINGLE(ThreadManager)->ParallelFor(taskCount, 1, [this](int32 begin, int32 end) {
+		for (int32 i = begin; i < end; ++i)
+			RunNarrowphaseTask(_tasks[i]);
+	});
+}
+
+void CollisionManager::RunNarrowphaseTask(NarrowphaseTask& task)
+{
+	task.sweptHits.clear();
+
+	// pair는 src 순서로 정렬되어 있으므로 같은 src끼리 묶어서 검사
+	for (int32 begin = task.begin; begin < task.end;) {
+		const int32 src = _pairs[begin].src;
+		int32 end = begin;
+		while (end < task.end && _pairs[end].src == src)
+			++end;
+
+		for (int32 type = 0; type < 2; ++type) {
+			task.batchRows[type].clear();
+			task.batchSlots[type].clear();
+		}
+
+		const int32 a = _arrays.rows[src];
+		for (int32 i = begin; i < end; ++i) {
+			const int32 b = _arrays.rows[_pairs[i].dest];
+
+			// Overlap/Hit은 layer 테이블에서 바로 찾는다.
+			const CollisionResponse response = CollisionLayerTable::GetResponse(_arrays.layers[a], _arrays.flags[a], _arrays.layers[b], _arrays.flags[b]);
+			if (response == CollisionResponse::CR_Ignore)
+				continue;
+
+			// 빠르게 움직이는 Collider는 이동 경로로 따로 검사 (수가 적으므로 scalar)
+			if (_arrays.continuous[a] || _arrays.continuous[b]) {
+				float time = 0.f;
+				Vector2D normal = Vector2D::Zero;
+				_results[i] = CollisionUtils::SweptTest(_arrays, a, b, time, normal);
+				if (_results[i])
+					task.sweptHits.push_back({ i, time, normal });
+				continue;
 			}
+
+			const int32 type = static_cast<int32>(_arrays.types[b]);
+			task.batchRows[type].push_back(b);
+			task.batchSlots[type].push_back(i);
 		}
+
+		TestBatch(task, a, ColliderType::CT_Square);
+		TestBatch(task, a, ColliderType::CT_Circle);
+
+		begin = end;
+	}
+
+	// 이 task에서 충돌한 pair
+	task.hits.clear();
+	for (int32 i = task.begin; i < task.end; ++i) {
+		if (_results[i])
+			task.hits.push_back(i);
+	}
+}
+
+void CollisionManager::TestBatch(NarrowphaseTask& task, int32 src, ColliderType otherType)
+{
+	const int32 type = static_cast<int32>(otherType);
+	const std::vector<int32>& rows = task.batchRows[type];
+	if (rows.empty())
+		return;
+
+	const int32 count = static_cast<int32>(rows.size());
+	task.batchResults.resize(rows.size());
+
+	const bool srcIsSquare = _arrays.types[src] == ColliderType::CT_Square;
+	if (otherType == ColliderType::CT_Square) {
+		if (srcIsSquare)
+			CollisionUtils::BoxVsBoxes(_arrays, src, rows.data(), count, task.batchResults.data());
+		else
+			CollisionUtils::CircleVsBoxes(_arrays, src, rows.data(), count, task.batchResults.data());
+	}
+	else {
+		if (srcIsSquare)
+			CollisionUtils::BoxVsCircles(_arrays, src, rows.data(), count, task.batchResults.data());
+		else
+			CollisionUtils::CircleVsCircles(_arrays, src, rows.data(), count, task.batchResults.data());
+	}
+
+	for (int32 i = 0; i < count; ++i)
+		_results[task.batchSlots[type][i]] = task.batchResults[i];
+}
+
+void CollisionManager::BuildLayerTable()
+{
+	// 같은 layer(bucket)를 가진 Collider들의 flag를 모두 합친다.
+	uint8 layerFlags[CollisionLayerTable::LAYER_COUNT] = {};
+	for (int32 i = 0; i < _arrays.Size(); ++i)
+		layerFlags[_arrays.layerIndices[i]] |= _arrays.flags[i];
+
+	_layerTable.Build(layerFlags);
+}
+
+bool CollisionManager::RaycastFirst(const Vector2D& start, const Vector2D& end, uint8 layerMask, RaycastHit& hit, const Actor* ignoreOwner)
+{
+	FindQueryRows(min(start.X, end.X), min(start.Y, end.Y), max(start.X, end.X), max(start.Y, end.Y));
+
+	const Vector2D dir = end - start;
+	bool found = false;
+	for (int32 row : _queryRows) {
+		std::shared_ptr<Collider> collider = GetQueryCollider(row, layerMask, ignoreOwner);
+		if (collider == nullptr)
+			continue;
+
+		float time = 0.f;
+		Vector2D normal = Vector2D::Zero;
+		const bool result = _arrays.types[row] == ColliderType::CT_Square
+			? CollisionUtils::RayToBox(start.X, start.Y, dir.X, dir.Y, _arrays.minX[row], _arrays.minY[row], _arrays.maxX[row], _arrays.maxY[row], time, normal)
+			: CollisionUtils::RayToCircle(start.X, start.Y, dir.X, dir.Y, _arrays.centerX[row], _arrays.centerY[row], _arrays.radius[row], time, normal);
+
+		// 같은 시간이면 먼저 등록된 Collider
+		if (result == false || (found && time >= hit.time))
+			continue;
+
+		found = true;
+		hit.collider = collider;
+		hit.time = time;
+		hit.normal = normal;
+		hit.point = start + dir * time;
 	}
+
+	return found;
 }
 
+void CollisionManager::OverlapBox(const Vector2D& center, const Vector2D& halfSize, uint8 layerMask, std::vector<std::shared_ptr<Collider>>& results, const Actor* ignoreOwner)
+{
+	const float minX = center.X - halfSize.X, minY = center.Y - halfSize.Y;
+	const float maxX = center.X + halfSize.X, maxY = center.Y + halfSize.Y;
+	FindQueryRows(minX, minY, maxX, maxY);
+
+	for (int32 row : _queryRows) {
+		std::shared_ptr<Collider> collider = GetQueryCollider(row, layerMask, ignoreOwner);
+		if (collider == nullptr)
+			continue;
+
+		const bool result = _arrays.types[row] == ColliderType::CT_Square
+			? CollisionUtils::BoxToBox(minX, minY, maxX, maxY, _arrays.minX[row], _arrays.minY[row], _arrays.maxX[row], _arrays.maxY[row])
+			: CollisionUtils::CircleToBox(_arrays.centerX[row], _arrays.centerY[row], _arrays.radius[row], minX, minY, maxX, maxY);
+		if (result)
+			results.push_back(collider);
+	}
+}
+
+void CollisionManager::OverlapCircle(const Vector2D& center, float radius, uint8 layerMask, std::vector<std::shared_ptr<Collider>>& results, const Actor* ignoreOwner)
+{
+	FindQueryRows(center.X - radius, center.Y - radius, center.X + radius, center.Y + radius);
+
+	for (int32 row : _queryRows) {
+		std::shared_ptr<Collider> collider = GetQueryCollider(row, layerMask, ignoreOwner);
+		if (collider == nullptr)
+			continue;
+
+		const bool result = _arrays.types[row] == ColliderType::CT_Square
+			? CollisionUtils::CircleToBox(center.X, center.Y, radius, _arrays.minX[row], _arrays.minY[row], _arrays.maxX[row], _arrays.maxY[row])
+			: CollisionUtils::CircleToCircle(center.X, center.Y, radius, _arrays.centerX[row], _arrays.centerY[row], _arrays.radius[row]);
+		if (result)
+			results.push_back(collider);
+	}
+}
+
+void CollisionManager::FindQueryRows(float minX, float minY, float maxX, float maxY)
+{
+	_queryRows.clear();
+	if (_broadphase == nullptr)
+		return;
+
+	const RECT bounds = {
+		static_cast<LONG>(std::floor(minX)),
+		static_cast<LONG>(std::floor(minY)),
+		static_cast<LONG>(std::ceil(maxX)),
+		static_cast<LONG>(std::ceil(maxY))
+	};
+	_broadphase->Query(_arrays, bounds, _queryRows);
+}
+
+std::shared_ptr<Collider> CollisionManager::GetQueryCollider(int32 row, uint8 layerMask, const Actor* ignoreOwner) const
+{
+	if ((_arrays.layers[row] & layerMask) == 0)
+		return nullptr;
+
+	// 마지막 Tick 이후 제거된 Collider
+	const int32 index = FindColliderIndex(_colliders, _arrays.ids[row]);
+	if (index < 0)
+		return nullptr;
+
+	std::shared_ptr<Collider> collider = _colliders[index];
+	if (collider->GetCollisionEnable() == false)
+		return nullptr;
+	if (ignoreOwner && collider->GetOwner().get() == ignoreOwner)
+		return nullptr;
+
+	return collider;
+}
 
 void CollisionManager::AddCollider(std::shared_ptr<Collider> collider)
 {
+	// Broadphase에서 Tick이 지나도 같은 Collider인지 구분할 수 있도록 고유 id 부여
+	collider->SetCollisionId(_nextColliderId++);
 	_colliders.push_back(collider);
 }
 
@@ -58,4 +448,32 @@ void CollisionManager::RemoveCollider(std::shared_ptr<Collider> collider)
 		return;
 	auto it = std::remove(_colliders.begin(), _colliders.end(), collider);
 	_colliders.erase(it, _colliders.end());
+
+	// 제거된 Collider의 pair는 이벤트 없이 정리
+	_contactCache.Remove(collider->GetCollisionId());
+}
+
+void CollisionManager::SetBroadphase(BroadphaseType type)
+{
+	_broadphaseType = type;
+
+	switch (type)
+	{
+	case BroadphaseType::BP_SpatialHash:
+		_broadphase = std::make_unique<SpatialHashGrid>(_cellSize);
+		break;
+	case BroadphaseType::BP_SweepAndPrune:
+		_broadphase = std::make_unique<SweepAndPrune>();
+		break;
+	default:
+		break;
+	}
+}
+
+void CollisionManager::SetCellSize(int32 cellSize)
+{
+	_cellSize = cellSize;
+
+	if (_broadphaseType == BroadphaseType::BP_SpatialHash)
+		SetBroadphase(_broadphaseType);
 }
@@ -1,6 +1,36 @@
 #pragma once
+#include "Collision\Broadphase.h"
+#include "Collision\CollisionLayerTable.h"
+#include "Collision\ColliderArrays.h"
+#include "Collision\ContactPairCache.h"
 
 class Collider;
+class Actor;
+
+// 매 Tick 충돌 검사 통계 (Debug 출력용)
+struct CollisionStats {
+	int32 colliderCount = 0;
+	int32 pairsTested = 0; // CheckCollision을 호출한 pair 수
+	int32 pairsHit = 0;	   // 실제로 충돌한 pair 수
+	int32 events = 0;	   // 발생시킨 이벤트 수
+	int32 tasks = 0;	   // narrowphase를 나눈 수 (thread에서 같이 처리)
+	int32 resting = 0;	   // 움직이지 않아 서로 검사하지 않은 Collider 수 (Static/Sleep)
+};
+
+// 검사 중에는 이벤트를 기록만 하고 검사가 모두 끝난 뒤 한번에 발생시킨다.
+struct CollisionEvent {
+	CollisionEventType type;
+	uint32 srcId;
+	uint32 destId;
+};
+
+// RaycastFirst의 결과
+struct RaycastHit {
+	std::shared_ptr<Collider> collider;
+	Vector2D point = Vector2D::Zero;	// 처음 닿은 위치
+	Vector2D normal = Vector2D::Zero;	// 닿은 면의 바깥쪽 방향 (시작점이 Collider 안이면 Zero)
+	float time = 0.f;					// start ~ end 중 닿은 비율 (0 ~ 1)
+};
 
 class CollisionManager
 {
@@ -14,7 +44,104 @@ public:
 	void AddCollider(std::shared_ptr<Collider> collider);
 	void RemoveCollider(std::shared_ptr<Collider> collider);
 
+	// 잠든 Collider가 깨어나면 다음 Tick에 주변에 잠든 Collider도 깨운다.
+	void RequestWake(uint32 id) { _wakeRequests.push_back(id); }
+
+public:
+	void SetBroadphase(BroadphaseType type);
+	BroadphaseType GetBroadphaseType() const { return _broadphaseType; }
+
+	// Spatial Hash 격자 크기 (ex: Tile 크기의 배수)
+	void SetCellSize(int32 cellSize);
+	int32 GetCellSize() const { return _cellSize; }
+
+	// 두 Collider가 충돌중인지 (pair cache에서 O(1)로 확인)
+	bool IsCollided(const Collider* a, const Collider* b) const;
+
+	/*
+		한번만 확인하는 Query (Collider를 따로 만들지 않고 Broadphase로 후보만 찾아 검사)
+			- 마지막 Tick의 위치 기준, 활성화된 Collider만
+			- layerMask = 찾을 CollisionLayerType bit들, ignoreOwner의 Collider는 제외 (ex: 자기 자신)
+			- 결과는 Collider가 등록된 순서
+	*/
+	bool RaycastFirst(const Vector2D& start, const Vector2D& end, uint8 layerMask, RaycastHit& hit, const Actor* ignoreOwner = nullptr);
+	void OverlapBox(const Vector2D& center, const Vector2D& halfSize, uint8 layerMask, std::vector<std::shared_ptr<Collider>>& results, const Actor* ignoreOwner = nullptr);
+	void OverlapCircle(const Vector2D& center, float radius, uint8 layerMask, std::vector<std::shared_ptr<Collider>>& results, const Actor* ignoreOwner = nullptr);
+
+	const CollisionStats& GetStats() const { return _stats; }
+	const CollisionLayerTable& GetLayerTable() const { return _layerTable; }
+
+private:
+	void BuildLayerTable();
+	void WakeNeighbours();
+	void KeepRestingContacts();
+	int32 FindColliderIndex(const std::vector<std::shared_ptr<Collider>>& colliders, uint32 id) const;
+	void RecordEvents();
+	void DispatchEvents(const std::vector<std::shared_ptr<Collider>>& colliders);
+
+	// Query 범위와 겹칠 수 있는 row를 _queryRows에 찾고 row의 Collider를 반환 (조건에 맞지 않으면 nullptr)
+	void FindQueryRows(float minX, float minY, float maxX, float maxY);
+	std::shared_ptr<Collider> GetQueryCollider(int32 row, uint8 layerMask, const Actor* ignoreOwner) const;
+
+	// narrowphase를 나눠서 처리하는 단위 (thread마다 자기 task의 데이터만 사용)
+	struct NarrowphaseTask {
+		int32 begin = 0;			// 맡은 _pairs 범위
+		int32 end = 0;
+		std::vector<int32> hits;	// 충돌한 pair index (순서대로)
+
+		// 이동 경로로 부딪힌 pair의 처음 닿은 시간과 방향 (hits 중 continuous pair만, 순서대로)
+		struct SweptHit {
+			int32 pair;
+			float time;
+			Vector2D normal;
+		};
+		std::vector<SweptHit> sweptHits;
+
+		// 같은 src를 가진 pair들을 ColliderType별로 모아 한번에 검사 (후보 row, pair index)
+		std::vector<int32> batchRows[2];
+		std::vector<int32> batchSlots[2];
+		std::vector<uint8> batchResults;
+	};
+
+	void RunNarrowphase();
+	void RunNarrowphaseTask(NarrowphaseTask& task);
+	void TestBatch(NarrowphaseTask& task, int32 src, ColliderType otherType);
+
 private:
 	std::vector<std::shared_ptr<Collider>> _colliders;
-};
 
+	// 매 Tick Component에서 복사한 narrowphase용 데이터
+	ColliderArrays _arrays;
+
+	std::unique_ptr<Broadphase> _broadphase;
+	BroadphaseType _broadphaseType = BroadphaseType::BP_SpatialHash;
+	int32 _cellSize = 96;
+
+	// layer bucket끼리 충돌할 수 있는지 (매 Tick flag로 다시 계산)
+	CollisionLayerTable _layerTable;
+
+	std::vector<CollisionPair> _pairs;
+	// _pairs와 같은 순서의 narrowphase 결과
+	std::vector<uint8> _results;
+	std::vector<NarrowphaseTask> _tasks;
+	// task 하나가 맡을 최소 pair 수
+	static constexpr int32 MIN_PAIRS_PER_TASK = 1024;
+
+	// 충돌중인 pair (Collider id 2개로 만든 key)
+	ContactPairCache _contactCache;
+	std::vector<uint64> _hits;
+	std::vector<ContactChange> _contactChanges;
+
+	// 이번 Tick에 발생시킬 이벤트 (pair key 순서)
+	std::vector<CollisionEvent> _events;
+
+	// Query 중에 사용하는 후보 row
+	std::vector<int32> _queryRows;
+
+	// 이번 Tick에 깨어난 Collider id
+	std::vector<uint32> _wakeRequests;
+
+	uint32 _nextColliderId = 0;
+
+	CollisionStats _stats;
+};
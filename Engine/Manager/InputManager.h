@@ -3,7 +3,7 @@
 // Singleton Pattenr
 class InputManager
 {
-	GENERATE_SINGLE(InputManager) // UE Generate_body ̷  ?
+	GENERATE_SINGLE(InputManager) // UE의 Generate_body가 이런식으로 만들어져있지 않을까?
 public:
 	~InputManager();
 
@@ -17,7 +17,7 @@ public:
 	void SetMousePos();
 	POINT GetMousePos() const { return _mousePos; }
 	
-	// TODO : Button Event FunctionPtr 
+	// TODO : Button Event에 FunctionPtr 연결
 	// parameter : KeyType, EventType, owner, function_ptr
 
 private:
@@ -28,5 +28,5 @@ private:
 	POINT _mousePos;
 	RECT _rect;
 
-	// TODO:  TriggerEvent Type  ϴ ͵?
+	// TODO: 따로 TriggerEvent Type을 만들어 사용하는 것도?
 };
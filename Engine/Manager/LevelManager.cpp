@@ -23,10 +23,10 @@ void LevelManager::Tick(float DeltaTime)
 		_level->Tick(DeltaTime);
 }
 
-void LevelManager::Render(HDC hdc)
+void LevelManager::Render(DrawList& drawList)
 {
 	if (_level)
-		_level->Render(hdc);
+		_level->Render(drawList);
 }
 
 void LevelManager::ChangeLevel(LevelType levelType)
@@ -1,6 +1,7 @@
 #pragma once
 
 class Level;
+class DrawList;
 
 class LevelManager
 {
@@ -10,7 +11,7 @@ public:
 
 	void Init();
 	void Tick(float DeltaTime);
-	void Render(HDC hdc);
+	void Render(DrawList& drawList);
 
 public:
 	void ChangeLevel(LevelType levelType);
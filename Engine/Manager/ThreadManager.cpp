@@ -0,0 +1,114 @@
+#include "pch.h"
+#include "ThreadManager.h"
+
+ThreadManager::~ThreadManager()
+{
+	Clear();
+}
+
+void ThreadManager::Init(int32 threadCount)
+{
+	Clear();
+
+	if (threadCount <= 0)
+		threadCount = max(1, static_cast<int32>(std::thread::hardware_concurrency()));
+
+	// 호출한 thread도 같이 일하므로 하나 적게 만든다.
+	for (int32 i = 0; i < threadCount - 1; ++i)
+		_workers.emplace_back(&ThreadManager::WorkerLoop, this);
+}
+
+void ThreadManager::Clear()
+{
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		_stop = true;
+	}
+	_wakeCondition.notify_all();
+
+	for (std::thread& worker : _workers) {
+		if (worker.joinable())
+			worker.join();
+	}
+	_workers.clear();
+
+	std::lock_guard<std::mutex> lock(_lock);
+	_stop = false;
+	_job = nullptr;
+}
+
+void ThreadManager::ParallelFor(int32 count, int32 grainSize, const std::function<void(int32, int32)>& func)
+{
+	if (count <= 0)
+		return;
+
+	grainSize = max(1, grainSize);
+
+	// worker가 없거나 나눌 만큼 크지 않으면 그냥 실행
+	if (_workers.empty() || count <= grainSize) {
+		func(0, count);
+		return;
+	}
+
+	std::lock_guard<std::mutex> parallelForLock(_parallelForLock);
+
+	std::shared_ptr<Job> job = std::make_shared<Job>();
+	job->func = func;
+	job->count = count;
+	job->grainSize = grainSize;
+	job->chunkCount = (count + grainSize - 1) / grainSize;
+
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		_job = job;
+		++_jobIndex;
+	}
+	_wakeCondition.notify_all();
+
+	// 호출한 thread도 같이 처리
+	RunChunks(*job);
+
+	// 다른 worker가 가져간 일이 끝날때까지 대기
+	std::unique_lock<std::mutex> lock(_lock);
+	_doneCondition.wait(lock, [&job]() { return job->doneChunks.load() == job->chunkCount; });
+	_job = nullptr;
+}
+
+void ThreadManager::WorkerLoop()
+{
+	uint64 lastJobIndex = 0;
+
+	while (true) {
+		std::shared_ptr<Job> job;
+		{
+			std::unique_lock<std::mutex> lock(_lock);
+			_wakeCondition.wait(lock, [this, lastJobIndex]() { return _stop || (_job && _jobIndex != lastJobIndex); });
+			if (_stop)
+				return;
+
+			job = _job;
+			lastJobIndex = _jobIndex;
+		}
+
+		RunChunks(*job);
+	}
+}
+
+void ThreadManager::RunChunks(Job& job)
+{
+	while (true) {
+		const int32 chunk = job.nextChunk.fetch_add(1);
+		if (chunk >= job.chunkCount)
+			return;
+
+		const int32 begin = chunk * job.grainSize;
+		const int32 end = min(job.count, begin + job.grainSize);
+		job.func(begin, end);
+
+		// 마지막 chunk를 끝낸 thread가 기다리는 thread를 깨운다.
+		if (job.doneChunks.fetch_add(1) + 1 == job.chunkCount) {
+			std::lock_guard<std::mutex> lock(_lock);
+			_doneCondition.notify_all();
+		}
+	}
+}
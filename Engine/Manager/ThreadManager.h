@@ -0,0 +1,52 @@
+#pragma once
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+/*
+	Worker Thread Pool
+		- 미리 만들어둔 worker thread들이 ParallelFor로 나눈 일을 같이 처리한다.
+		- 호출한 thread(Game thread)도 같이 일하고, 모든 일이 끝나야 ParallelFor가 반환된다.
+*/
+class ThreadManager
+{
+	GENERATE_SINGLE(ThreadManager);
+public:
+	~ThreadManager();
+
+	// threadCount = 호출한 thread를 포함한 전체 수 (0이면 CPU core 수)
+	void Init(int32 threadCount = 0);
+	void Clear();
+
+	// [0, count)를 grainSize 크기로 나눠 처리 : func(begin, end)
+	void ParallelFor(int32 count, int32 grainSize, const std::function<void(int32, int32)>& func);
+
+	int32 GetThreadCount() const { return static_cast<int32>(_workers.size()) + 1; }
+
+private:
+	struct Job {
+		std::function<void(int32, int32)> func;
+		int32 count = 0;
+		int32 grainSize = 1;
+		int32 chunkCount = 0;
+		std::atomic<int32> nextChunk = 0;
+		std::atomic<int32> doneChunks = 0;
+	};
+
+	void WorkerLoop();
+	void RunChunks(Job& job);
+
+private:
+	std::vector<std::thread> _workers;
+
+	std::mutex _lock;
+	std::condition_variable _wakeCondition;	// 새 Job이 생기면 worker를 깨운다
+	std::condition_variable _doneCondition;	// Job이 모두 끝나면 호출한 thread를 깨운다
+	std::shared_ptr<Job> _job;
+	uint64 _jobIndex = 0;
+	bool _stop = false;
+
+	// ParallelFor는 한번에 하나만 실행
+	std::mutex _parallelForLock;
+};
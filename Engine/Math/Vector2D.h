@@ -13,7 +13,7 @@ struct Vector2D
 	}
 
 	Vector2D& operator=(const Vector2D& other) {
-		if (&other == this) // 
+		if (&other == this) // 같으면
 			return *this;
 
 		X = other.X;
@@ -36,7 +36,7 @@ struct Vector2D
 	}
 
 	float operator[](int8 indeX) {
-		assert(indeX < Dimension); // Dimension ũ assert error
+		assert(indeX < Dimension); // Dimension보다 크면 assert error
 		return Scalars[indeX];
 	}
 
@@ -99,12 +99,12 @@ struct Vector2D
 	}
 
 
-	// ܼ 길 Ҷ sqrt  ص ȴ. (귮 Ƴ)
+	// 단순 계산만 할땐 sqrt를 굳이 안해도 된다. (계산량 아끼기)
 	float LengthSquared() {
 		return X * X + Y * Y;
 	}
 
-	// 
+	// 길이
 	float Length() {
 		return std::sqrtf(LengthSquared());
 	}
@@ -117,19 +117,19 @@ struct Vector2D
 			return Vector2D::Zero;
 
 		float invLength = MathUtils::InvSqrt(lengthSq); // 1 / sqrt(X)
-		return Vector2D(X, Y) * invLength; // sqrt(X)  Ͱ .
+		return Vector2D(X, Y) * invLength; // sqrt(X)로 나누는 것과 같다.
 	}
 
 	void Normalize() {
 		*this = GetNormalize();
 	}
 
-	//   cos(theta)   ִ.
+	// 단위벡터인 경우 cos(theta)를 구할 수 있다.
 	float Dot(const Vector2D& other) {
 		return X * other.X + Y * other.Y;
 	}
 
-	//   sin(theta)   ִ.
+	// 단위벡터인 경우 sin(theta)를 구할 수 있다.
 	float Cross(const Vector2D& other)
 	{
 		return X * other.Y - Y * other.X;
@@ -149,5 +149,5 @@ struct Vector2D
 	};
 };
 
-// float * Vector2D .
+// float * Vector2D가 가능해진다.
 extern Vector2D operator*(const float& scalar, const Vector2D& v);
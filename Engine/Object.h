@@ -1,5 +1,7 @@
 #pragma once
 
+class RenderTarget;
+
 enum class ObjectType {
 	Object,
 	Actor,
@@ -14,18 +16,18 @@ public:
 
 	virtual void Init() = 0;
 	virtual void Tick(float DeltaTime) = 0;
-	virtual void Render(HDC hdc) = 0;
+	virtual void Render(RenderTarget& target) = 0;
 
 	/*
-		UE C++ Asset  ϱ
+		UE의 C++에서 Asset 가져와 사용하기
 		static ConstructorHelper::FObjectFinder<UStaticMesh> SM_TEMP(TEXT("path"));
 		if (SM_TEMP.Succeeded())
 			TempComponent->SetStaticMehs(SM_TEMP.Object);
 
-		TODO: Asset Asset   ϰ Component Ѱֱ
-		TODO: Template  Լ  Ÿ   ְ ϱ (?)
+		TODO: Asset에 Asset이 있으면 가져와 등록하고 Component에 넘겨주기
+		TODO: Template으로 한 함수로 모든 타입을 가져올 수 있게 하기 (어떻게?)
 
-		(type-trait ϸ Ҽ, ex: std::is_convertiable<> ȯ  Ȯ)
+		(type-trait를 사용하면 가능할수도, ex: std::is_convertiable<> 변환가능 한지 확인)
 	*/
 
 	template<typename ReturnType>
@@ -0,0 +1,164 @@
+#include "pch.h"
+#include "CullGrid.h"
+
+namespace {
+	// 이보다 많은 cell에 걸치면 cell에 넣지 않는다.
+	constexpr int32 MAX_ENTRY_CELLS = 16;
+
+	// right, bottom은 포함하지 않는다.
+	bool Overlaps(const RECT& a, const RECT& b)
+	{
+		return a.left < b.right && b.left < a.right && a.top < b.bottom && b.top < a.bottom;
+	}
+}
+
+CullGrid::CullGrid(int32 cellSize) : _cellSize(max(1, cellSize))
+{
+}
+
+CullGrid::~CullGrid()
+{
+}
+
+void CullGrid::Update(uint32 id, const RECT* bounds)
+{
+	Entry entry = {};
+	if (bounds) {
+		entry.bounds = *bounds;
+		entry.minCellX = ToCell(bounds->left);
+		entry.minCellY = ToCell(bounds->top);
+		entry.maxCellX = ToCell(max(bounds->left, bounds->right - 1));
+		entry.maxCellY = ToCell(max(bounds->top, bounds->bottom - 1));
+
+		const int64 cellCount = static_cast<int64>(entry.maxCellX - entry.minCellX + 1) * (entry.maxCellY - entry.minCellY + 1);
+		entry.large = cellCount > MAX_ENTRY_CELLS;
+	}
+	else {
+		// 모든 영역과 겹친다.
+		entry.bounds = { LONG_MIN, LONG_MIN, LONG_MAX, LONG_MAX };
+		entry.large = true;
+	}
+
+	auto it = _entries.find(id);
+	if (it != _entries.end()) {
+		Entry& prev = it->second;
+
+		// 같은 cell 안에서 움직였으면 영역만 바꾼다.
+		if (prev.large == entry.large && (entry.large
+			|| (prev.minCellX == entry.minCellX && prev.minCellY == entry.minCellY && prev.maxCellX == entry.maxCellX && prev.maxCellY == entry.maxCellY))) {
+			prev.bounds = entry.bounds;
+			return;
+		}
+
+		Erase(id, prev);
+		prev = entry;
+	}
+	else {
+		_entries.emplace(id, entry);
+	}
+
+	Insert(id, entry);
+}
+
+void CullGrid::Remove(uint32 id)
+{
+	auto it = _entries.find(id);
+	if (it == _entries.end())
+		return;
+
+	Erase(id, it->second);
+	_entries.erase(it);
+}
+
+void CullGrid::Clear()
+{
+	_cells.clear();
+	_entries.clear();
+	_large.clear();
+}
+
+void CullGrid::Query(const RECT& bounds, std::vector<uint32>& ids) const
+{
+	ids.clear();
+
+	auto addId = [&](uint32 id) {
+		const Entry& entry = _entries.find(id)->second;
+		if (Overlaps(entry.bounds, bounds))
+			ids.push_back(id);
+	};
+
+	const int32 minX = ToCell(bounds.left);
+	const int32 minY = ToCell(bounds.top);
+	const int32 maxX = ToCell(max(bounds.left, bounds.right - 1));
+	const int32 maxY = ToCell(max(bounds.top, bounds.bottom - 1));
+	for (int32 y = minY; y <= maxY; ++y) {
+		for (int32 x = minX; x <= maxX; ++x) {
+			auto it = _cells.find(MakeKey(x, y));
+			if (it == _cells.end())
+				continue;
+			for (uint32 id : it->second)
+				addId(id);
+		}
+	}
+
+	for (uint32 id : _large)
+		addId(id);
+
+	// 여러 cell에 걸친 id는 여러번 들어간다.
+	std::sort(ids.begin(), ids.end());
+	ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+}
+
+int32 CullGrid::ToCell(LONG value) const
+{
+	// 음수 좌표도 올바른 cell에 들어가도록 내림 나눗셈
+	int32 cell = value / _cellSize;
+	if (value < 0 && value % _cellSize != 0)
+		--cell;
+	return cell;
+}
+
+uint64 CullGrid::MakeKey(int32 x, int32 y)
+{
+	return (static_cast<uint64>(static_cast<uint32>(x)) << 32) | static_cast<uint32>(y);
+}
+
+void CullGrid::Insert(uint32 id, const Entry& entry)
+{
+	if (entry.large) {
+		_large.insert(std::lower_bound(_large.begin(), _large.end(), id), id);
+		return;
+	}
+
+	for (int32 y = entry.minCellY; y <= entry.maxCellY; ++y)
+		for (int32 x = entry.minCellX; x <= entry.maxCellX; ++x)
+			_cells[MakeKey(x, y)].push_back(id);
+}
+
+void CullGrid::Erase(uint32 id, const Entry& entry)
+{
+	if (entry.large) {
+		auto it = std::lower_bound(_large.begin(), _large.end(), id);
+		if (it != _large.end() && *it == id)
+			_large.erase(it);
+		return;
+	}
+
+	for (int32 y = entry.minCellY; y <= entry.maxCellY; ++y) {
+		for (int32 x = entry.minCellX; x <= entry.maxCellX; ++x) {
+			auto it = _cells.find(MakeKey(x, y));
+			if (it == _cells.end())
+				continue;
+
+			// cell 안의 순서는 상관없다.
+			std::vector<uint32>& cell = it->second;
+			auto found = std::find(cell.begin(), cell.end(), id);
+			if (found != cell.end()) {
+				*found = cell.back();
+				cell.pop_back();
+			}
+			if (cell.empty())
+				_cells.erase(it);
+		}
+	}
+}
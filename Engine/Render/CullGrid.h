@@ -0,0 +1,45 @@
+#pragma once
+
+/*
+	CullGrid
+		- 그리는 영역(World 좌표)을 cellSize 격자에 넣어두고 카메라 영역과 겹치는 id만 찾는다.
+		- 영역이 바뀐 id만 다시 넣는다. (움직이지 않는 Actor는 한번만 넣는다)
+		- 너무 큰 영역(배경, Tilemap)과 영역이 없는 id는 cell에 넣지 않고 Query마다 따로 검사한다.
+		- key = cell 좌표 (SpatialHashGrid와 같다)
+*/
+class CullGrid
+{
+public:
+	// 기본값은 800x600 화면이 4x3 cell 정도
+	CullGrid(int32 cellSize = 256);
+	~CullGrid();
+
+	// 넣거나 옮긴다. (bounds = nullptr면 항상 찾는다)
+	void Update(uint32 id, const RECT* bounds);
+	void Remove(uint32 id);
+	void Clear();
+
+	// bounds와 겹치는 id들을 작은 것부터 중복없이 찾는다.
+	void Query(const RECT& bounds, std::vector<uint32>& ids) const;
+
+	int32 GetCount() const { return static_cast<int32>(_entries.size()); }
+
+private:
+	struct Entry {
+		RECT bounds;
+		int32 minCellX, minCellY, maxCellX, maxCellY;
+		bool large;		// cell에 넣지 않은 것 (_large)
+	};
+
+	int32 ToCell(LONG value) const;
+	static uint64 MakeKey(int32 x, int32 y);
+
+	void Insert(uint32 id, const Entry& entry);
+	void Erase(uint32 id, const Entry& entry);
+
+private:
+	int32 _cellSize;
+	std::unordered_map<uint64, std::vector<uint32>> _cells;
+	std::unordered_map<uint32, Entry> _entries;
+	std::vector<uint32> _large; // 정렬된 상태
+};
@@ -0,0 +1,90 @@
+#include "pch.h"
+#include "DebugDraw.h"
+#include "Render\RenderTarget.h"
+
+#if USE_DEBUG_DRAW
+
+DebugDraw::~DebugDraw()
+{
+}
+
+void DebugDraw::SetEnabled(DebugDrawCategory category, bool enabled)
+{
+	if (enabled)
+		_enabled |= category;
+	else
+		_enabled &= ~static_cast<uint32>(category);
+}
+
+void DebugDraw::AddRect(DebugDrawCategory category, int32 left, int32 top, int32 right, int32 bottom, uint32 color)
+{
+	if (IsEnabled(category) == false)
+		return;
+
+	_commands.push_back({ DDT_Rect, color, left, top, right, bottom });
+}
+
+void DebugDraw::AddCircle(DebugDrawCategory category, int32 centerX, int32 centerY, int32 radius, uint32 color)
+{
+	if (IsEnabled(category) == false)
+		return;
+
+	_commands.push_back({ DDT_Circle, color, centerX, centerY, radius, 0 });
+}
+
+void DebugDraw::AddLine(DebugDrawCategory category, int32 fromX, int32 fromY, int32 toX, int32 toY, uint32 color)
+{
+	if (IsEnabled(category) == false)
+		return;
+
+	_commands.push_back({ DDT_Line, color, fromX, fromY, toX, toY });
+}
+
+void DebugDraw::AddText(DebugDrawCategory category, int32 x, int32 y, std::wstring str, uint32 color)
+{
+	if (IsEnabled(category) == false)
+		return;
+
+	_commands.push_back({ DDT_Text, color, x, y, static_cast<int32>(_texts.size()), 0 });
+	_texts.push_back(std::move(str));
+}
+
+void DebugDraw::Flush(RenderTarget& target)
+{
+	// text는 마지막, 그 외는 색끼리 (같은 색 안에서는 넣은 순서)
+	std::stable_sort(_commands.begin(), _commands.end(), [](const DebugDrawCommand& lhs, const DebugDrawCommand& rhs) {
+		const bool lhsText = lhs.type == DDT_Text;
+		const bool rhsText = rhs.type == DDT_Text;
+		if (lhsText != rhsText)
+			return rhsText;
+		return lhs.color < rhs.color;
+	});
+
+	for (const DebugDrawCommand& cmd : _commands) {
+		switch (cmd.type) {
+		case DDT_Rect:
+			target.DrawRect(cmd.a, cmd.b, cmd.c, cmd.d, cmd.color);
+			break;
+		case DDT_Circle:
+			target.DrawCircle(cmd.a, cmd.b, cmd.c, cmd.color);
+			break;
+		case DDT_Line:
+			target.DrawLine(cmd.a, cmd.b, cmd.c, cmd.d, cmd.color);
+			break;
+		case DDT_Text:
+			target.DrawText(cmd.a, cmd.b, _texts[cmd.c], cmd.color);
+			break;
+		}
+	}
+
+	_flushedCount = static_cast<int32>(_commands.size());
+	Clear();
+}
+
+void DebugDraw::Clear()
+{
+	_commands.clear();
+	_texts.clear();
+}
+
+#endif
@@ -0,0 +1,71 @@
+#pragma once
+
+class RenderTarget;
+
+/*
+	DebugDraw
+		- Collider 도형, 정보 text 등을 Render 중에 모아뒀다가 World::Render 마지막에 한번에 그린다.
+		- 같은 색끼리 모아서 그린다. (text는 도형 위에)
+		- 좌표는 화면 좌표 (RenderTarget과 같다)
+		- 직접 호출하지 않고 아래 DEBUG_DRAW_* 를 사용한다. (USE_DEBUG_DRAW가 0이면 아무것도 하지 않는다)
+*/
+class DebugDraw
+{
+	GENERATE_SINGLE(DebugDraw)
+public:
+	~DebugDraw();
+
+	void SetEnabled(DebugDrawCategory category, bool enabled);
+	void Toggle(DebugDrawCategory category) { _enabled ^= category; }
+	bool IsEnabled(DebugDrawCategory category) const { return (_enabled & category) != 0; }
+
+	// 꺼진 category는 넣지 않는다.
+	void AddRect(DebugDrawCategory category, int32 left, int32 top, int32 right, int32 bottom, uint32 color);
+	void AddCircle(DebugDrawCategory category, int32 centerX, int32 centerY, int32 radius, uint32 color);
+	void AddLine(DebugDrawCategory category, int32 fromX, int32 fromY, int32 toX, int32 toY, uint32 color);
+	void AddText(DebugDrawCategory category, int32 x, int32 y, std::wstring str, uint32 color);
+
+	// 모아둔 것을 그리고 비운다.
+	void Flush(RenderTarget& target);
+	void Clear();
+
+	// 마지막 Flush에서 그린 수
+	int32 GetFlushedCount() const { return _flushedCount; }
+
+private:
+	enum DebugDrawType : uint8 {
+		DDT_Rect,
+		DDT_Circle,
+		DDT_Line,
+		DDT_Text	// 마지막에 그린다.
+	};
+
+	struct DebugDrawCommand {
+		DebugDrawType type;
+		uint32 color;
+		int32 a, b, c, d;	// Rect = left, top, right, bottom / Circle = x, y, radius / Line = from, to / Text = x, y, _texts의 index
+	};
+
+private:
+	uint32 _enabled = DDC_All;
+	std::vector<DebugDrawCommand> _commands;
+	std::vector<std::wstring> _texts;
+	int32 _flushedCount = 0;
+};
+
+#if USE_DEBUG_DRAW
+#define DEBUG_DRAW_ENABLED(category)									GET_SINGLE(DebugDraw)->IsEnabled(category)
+#define DEBUG_DRAW_RECT(category, left, top, right, bottom, color)		GET_SINGLE(DebugDraw)->AddRect(category, left, top, right, bottom, color)
+#define DEBUG_DRAW_CIRCLE(category, centerX, centerY, radius, color)	GET_SINGLE(DebugDraw)->AddCircle(category, centerX, centerY, radius, color)
+#define DEBUG_DRAW_LINE(category, fromX, fromY, toX, toY, color)		GET_SINGLE(DebugDraw)->AddLine(category, fromX, fromY, toX, toY, color)
+#define DEBUG_DRAW_TEXT(category, x, y, str, color)						GET_SINGLE(DebugDraw)->AddText(category, x, y, str, color)
+#define DEBUG_DRAW_FLUSH(target)										GET_SINGLE(DebugDraw)->Flush(target)
+#else
+// 앞에서 DEBUG_DRAW_ENABLED로 확인한 코드는 컴파일러가 지운다.
+#define DEBUG_DRAW_ENABLED(category)									false
+#define DEBUG_DRAW_RECT(category, left, top, right, bottom, color)		((void)0)
+#define DEBUG_DRAW_CIRCLE(category, centerX, centerY, radius, color)	((void)0)
+#define DEBUG_DRAW_LINE(category, fromX, fromY, toX, toY, color)		((void)0)
+#define DEBUG_DRAW_TEXT(category, x, y, str, color)						((void)0)
+#define DEBUG_DRAW_FLUSH(target)										((void)0)
+#endif
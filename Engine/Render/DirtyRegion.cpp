@@ -0,0 +1,187 @@
+#include "pch.h"
+#include "DirtyRegion.h"
+#include "DrawList.h"
+#include "FrameBuffer.h"
+#include "TileRasterizer.h"
+
+namespace {
+	// 이보다 많이 나뉘면 하나로 합친다. (작은 사각형을 여러번 그리는 비용)
+	constexpr int32 MAX_DIRTY_RECTS = 16;
+	// 화면의 이 비율 이상이면 전체를 다시 그린다.
+	constexpr float FULL_REDRAW_RATIO = 0.6f;
+
+	int64 GetRectArea(const RECT& rect)
+	{
+		return static_cast<int64>(rect.right - rect.left) * (rect.bottom - rect.top);
+	}
+
+	// 맞닿은 경우도 합친다.
+	bool IsTouching(const RECT& a, const RECT& b)
+	{
+		return a.left <= b.right && b.left <= a.right && a.top <= b.bottom && b.top <= a.bottom;
+	}
+
+	// 명령에서 이전 frame과 비교할 값 (정렬 순서는 비교하지 않는다)
+	struct CommandEntry {
+		DrawCommandType type;
+		uint32 textureRevision;
+		int32 x, y, w, h, srcX, srcY;
+		uint32 color;
+		size_t textHash;
+		RECT bounds;
+
+		auto GetKey() const { return std::tie(type, textureRevision, x, y, w, h, srcX, srcY, color, textHash); }
+		bool operator<(const CommandEntry& other) const { return GetKey() < other.GetKey(); }
+		bool operator==(const CommandEntry& other) const { return GetKey() == other.GetKey(); }
+	};
+
+	void BuildEntries(const DrawList& drawList, const RenderTarget& target, std::vector<CommandEntry>& entries)
+	{
+		entries.clear();
+		entries.reserve(drawList.GetCommands().size());
+
+		for (const DrawCommand& command : drawList.GetCommands()) {
+			CommandEntry entry = { command.type, command.textureRevision, command.x, command.y, command.w, command.h, command.srcX, command.srcY, command.color, 0, drawList.GetBounds(command, target) };
+			// text는 index 대신 내용으로
+			if (command.type == DrawCommandType::DCT_Text) {
+				entry.w = 0;
+				entry.textHash = std::hash<std::wstring>()(drawList.GetText(command.w));
+			}
+			entries.push_back(entry);
+		}
+
+		std::sort(entries.begin(), entries.end());
+	}
+}
+
+void DirtyRegion::Reset(int32 width, int32 height)
+{
+	_width = width;
+	_height = height;
+	_full = false;
+	_rects.clear();
+}
+
+void DirtyRegion::Add(RECT rect)
+{
+	if (_full)
+		return;
+
+	const RECT screen = { 0, 0, _width, _height };
+	if (::IntersectRect(&rect, &rect, &screen) == FALSE)
+		return;
+
+	// 겹치는 사각형을 모두 합친 뒤 추가 (합쳐서 커지면 다른 사각형과 다시 겹칠 수 있다)
+	for (int32 i = 0; i < static_cast<int32>(_rects.size());) {
+		if (IsTouching(_rects[i], rect)) {
+			::UnionRect(&rect, &rect, &_rects[i]);
+			_rects[i] = _rects.back();
+			_rects.pop_back();
+			i = 0;
+			continue;
+		}
+		++i;
+	}
+	_rects.push_back(rect);
+
+	if (static_cast<int32>(_rects.size()) > MAX_DIRTY_RECTS) {
+		RECT bounds = _rects[0];
+		for (const RECT& r : _rects)
+			::UnionRect(&bounds, &bounds, &r);
+		_rects = { bounds };
+	}
+
+	if (GetArea() >= static_cast<int64>(GetRectArea(screen) * FULL_REDRAW_RATIO))
+		AddAll();
+}
+
+void DirtyRegion::AddAll()
+{
+	_full = true;
+	_rects = { RECT{ 0, 0, _width, _height } };
+}
+
+void DirtyRegion::AddChanges(const DrawList& prev, const DrawList& cur, const RenderTarget& target)
+{
+	std::vector<CommandEntry> prevEntries;
+	std::vector<CommandEntry> curEntries;
+	BuildEntries(prev, target, prevEntries);
+	BuildEntries(cur, target, curEntries);
+
+	// 정렬된 두 목록에서 한쪽에만 있는 명령 = 바뀐 명령 (이전 위치, 새 위치 모두 다시 그린다)
+	size_t i = 0;
+	size_t j = 0;
+	while ((i < prevEntries.size() || j < curEntries.size()) && _full == false) {
+		if (j == curEntries.size() || (i < prevEntries.size() && prevEntries[i] < curEntries[j])) {
+			Add(prevEntries[i++].bounds);
+		}
+		else if (i == prevEntries.size() || curEntries[j] < prevEntries[i]) {
+			Add(curEntries[j++].bounds);
+		}
+		else {
+			++i;
+			++j;
+		}
+	}
+}
+
+int64 DirtyRegion::GetArea() const
+{
+	// 합쳐진 사각형끼리는 겹치지 않는다.
+	int64 area = 0;
+	for (const RECT& rect : _rects)
+		area += GetRectArea(rect);
+	return area;
+}
+
+DirtyRectRenderer::DirtyRectRenderer()
+{
+	_frame = std::make_unique<DrawList>();
+	_prevFrame = std::make_unique<DrawList>();
+	_rasterizer = std::make_unique<TileRasterizer>();
+}
+
+DirtyRectRenderer::~DirtyRectRenderer()
+{
+}
+
+DrawList& DirtyRectRenderer::BeginFrame(int32 width, int32 height)
+{
+	_frame->Begin(width, height);
+	return *_frame;
+}
+
+void DirtyRectRenderer::EndFrame(RenderTarget& target, uint32 background)
+{
+	UpdateRegion(target);
+
+	for (const RECT& rect : _region.GetRects()) {
+		target.SetClipRect(&rect);
+		target.Clear(background);
+		_frame->Execute(target, rect);
+	}
+	target.SetClipRect(nullptr);
+
+	// 이번 frame은 다음 frame의 비교 대상
+	std::swap(_frame, _prevFrame);
+}
+
+void DirtyRectRenderer::EndFrame(FrameBuffer& target, uint32 background)
+{
+	UpdateRegion(target);
+
+	for (const RECT& rect : _region.GetRects())
+		_rasterizer->Execute(*_frame, target, rect, background);
+
+	std::swap(_frame, _prevFrame);
+}
+
+void DirtyRectRenderer::UpdateRegion(const RenderTarget& target)
+{
+	_region.Reset(target.GetWidth(), target.GetHeight());
+	if (_enabled == false || _fullRedraw)
+		_region.AddAll();
+	else
+		_region.AddChanges(*_prevFrame, *_frame, target);
+	_fullRedraw = false;
+}
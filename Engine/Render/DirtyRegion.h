@@ -0,0 +1,77 @@
+#pragma once
+
+class RenderTarget;
+class DrawList;
+class FrameBuffer;
+class TileRasterizer;
+
+/*
+	DirtyRegion
+		- 이번 frame에 다시 그려야 하는 화면 영역 (겹치거나 맞닿은 사각형은 합친다)
+		- 사각형이 많거나 화면의 대부분이면 화면 전체 하나로 바꾼다.
+*/
+class DirtyRegion
+{
+public:
+	void Reset(int32 width, int32 height);
+
+	// 화면 밖은 잘라낸다.
+	void Add(RECT rect);
+	void AddAll();
+	// 이전 frame과 이번 frame의 명령을 비교해서 없어진 명령, 새로 생긴 명령의 영역을 추가
+	void AddChanges(const DrawList& prev, const DrawList& cur, const RenderTarget& target);
+
+	bool IsEmpty() const { return _rects.empty(); }
+	bool IsFull() const { return _full; }
+	const std::vector<RECT>& GetRects() const { return _rects; }
+	// 다시 그리는 pixel 수
+	int64 GetArea() const;
+
+private:
+	int32 _width = 0;
+	int32 _height = 0;
+	bool _full = false;
+	std::vector<RECT> _rects;
+};
+
+/*
+	DirtyRectRenderer
+		- 매 frame 전체를 지우고 다시 그리는 대신 바뀐 영역(DirtyRegion)만 지우고 다시 그린다.
+		- BeginFrame이 돌려준 DrawList에 그린 뒤 EndFrame에서 이전 frame과 비교한다.
+		- target은 이전 frame의 결과를 그대로 가지고 있어야 한다. (back buffer를 지우지 않는다)
+		- 카메라가 움직이거나 창이 다시 그려져야 하면 MarkFullRedraw
+*/
+class DirtyRectRenderer
+{
+public:
+	DirtyRectRenderer();
+	~DirtyRectRenderer();
+
+	// 이번 frame의 명령을 모을 곳
+	DrawList& BeginFrame(int32 width, int32 height);
+	// 바뀐 영역만 background로 지우고 다시 그린다. (GetDirtyRegion = 창에 복사할 영역)
+	void EndFrame(RenderTarget& target, uint32 background);
+	// CPU FrameBuffer는 TileRasterizer로 여러 thread에서 그린다. (결과는 위와 같다)
+	void EndFrame(FrameBuffer& target, uint32 background);
+
+	void MarkFullRedraw() { _fullRedraw = true; }
+	// false = 매 frame 전체를 다시 그린다.
+	void SetEnabled(bool enabled) { _enabled = enabled; }
+	bool IsEnabled() const { return _enabled; }
+
+	const DirtyRegion& GetDirtyRegion() const { return _region; }
+	TileRasterizer& GetRasterizer() { return *_rasterizer; }
+
+private:
+	// 이번 frame에 다시 그릴 영역을 구한다.
+	void UpdateRegion(const RenderTarget& target);
+
+private:
+	std::unique_ptr<DrawList> _frame;
+	std::unique_ptr<DrawList> _prevFrame;
+	DirtyRegion _region;
+	std::unique_ptr<TileRasterizer> _rasterizer;
+	bool _fullRedraw = true;
+	bool _enabled = true;
+};
+
@@ -0,0 +1,229 @@
+#include "pch.h"
+#include "DrawList.h"
+#include "Resources\Texture.h"
+
+namespace {
+	constexpr int32 DEPTH_BITS = 24;
+	constexpr int32 DEPTH_BIAS = 1 << (DEPTH_BITS - 1); // 음수 Y도 정렬되도록
+	constexpr uint16 NO_TEXTURE = UINT16_MAX;
+
+	uint64 MakeSortKey(int32 layer, float depth, uint16 textureId)
+	{
+		const int64 quantized = std::clamp<int64>(static_cast<int64>(std::floor(depth)) + DEPTH_BIAS, 0, (1 << DEPTH_BITS) - 1);
+		return (static_cast<uint64>(layer & 0xFF) << 56) | (static_cast<uint64>(quantized) << 32) | (static_cast<uint64>(textureId) << 16);
+	}
+}
+
+DrawList::DrawList()
+{
+}
+
+DrawList::~DrawList()
+{
+}
+
+void DrawList::Begin(int32 width, int32 height)
+{
+	_width = width;
+	_height = height;
+	_layer = 0;
+	_sorted = false;
+	_depth = 0.f;
+
+	_commands.clear();
+	_texts.clear();
+	_stats = {};
+	_needSort = false;
+}
+
+void DrawList::Execute(RenderTarget& target)
+{
+	Sort();
+
+	const Texture* prevTexture = nullptr;
+	for (const DrawCommand& command : _commands) {
+		Dispatch(target, command);
+
+		if (command.texture && command.texture != prevTexture) {
+			++_stats.textureSwitches;
+			prevTexture = command.texture;
+		}
+	}
+	_stats.commands = static_cast<int32>(_commands.size());
+}
+
+void DrawList::Execute(RenderTarget& target, const RECT& clip)
+{
+	Sort();
+
+	target.SetClipRect(&clip);
+	for (const DrawCommand& command : _commands) {
+		RECT bounds = GetBounds(command, target);
+		RECT intersect;
+		if (::IntersectRect(&intersect, &bounds, &clip))
+			Dispatch(target, command);
+	}
+	target.SetClipRect(nullptr);
+}
+
+RECT DrawList::GetBounds(const DrawCommand& command, const RenderTarget& target) const
+{
+	// 도형은 선 두께(1px)만큼 여유를 둔다.
+	switch (command.type) {
+	case DrawCommandType::DCT_Blit:
+	case DrawCommandType::DCT_BlitColorKey:
+	case DrawCommandType::DCT_BlitAlpha:
+		return { command.x, command.y, command.x + command.w, command.y + command.h };
+	case DrawCommandType::DCT_Rect:
+	case DrawCommandType::DCT_Line:
+		return { min(command.x, command.w) - 1, min(command.y, command.h) - 1, max(command.x, command.w) + 2, max(command.y, command.h) + 2 };
+	case DrawCommandType::DCT_Circle:
+		return { command.x - command.w - 1, command.y - command.w - 1, command.x + command.w + 2, command.y + command.w + 2 };
+	case DrawCommandType::DCT_Text:
+	{
+		const SIZE size = target.GetTextSize(_texts[command.w]);
+		return { command.x, command.y, command.x + size.cx, command.y + size.cy };
+	}
+	}
+
+	// Clear
+	return { 0, 0, target.GetWidth(), target.GetHeight() };
+}
+
+void DrawList::Clear(uint32 color)
+{
+	// 다른 명령보다 먼저
+	DrawCommand command;
+	command.type = DrawCommandType::DCT_Clear;
+	command.color = color;
+	_commands.push_back(command);
+	_needSort = true;
+}
+
+void DrawList::SetClipRect(const RECT* clip)
+{
+}
+
+void DrawList::Blit(int32 x, int32 y, int32 w, int32 h, const Texture& texture, int32 srcX, int32 srcY)
+{
+	if (Cull(x, y, x + w, y + h))
+		return;
+
+	Push({ 0, nullptr, 0, x, y, w, h, srcX, srcY, 0, DrawCommandType::DCT_Blit }, &texture);
+}
+
+void DrawList::BlitColorKey(int32 x, int32 y, int32 w, int32 h, const Texture& texture, int32 srcX, int32 srcY)
+{
+	if (Cull(x, y, x + w, y + h))
+		return;
+
+	Push({ 0, nullptr, 0, x, y, w, h, srcX, srcY, 0, DrawCommandType::DCT_BlitColorKey }, &texture);
+}
+
+void DrawList::BlitAlpha(int32 x, int32 y, int32 w, int32 h, const Texture& texture, int32 srcX, int32 srcY, uint8 opacity)
+{
+	if (opacity == 0 || Cull(x, y, x + w, y + h))
+		return;
+
+	Push({ 0, nullptr, 0, x, y, w, h, srcX, srcY, opacity, DrawCommandType::DCT_BlitAlpha }, &texture);
+}
+
+void DrawList::DrawRect(int32 left, int32 top, int32 right, int32 bottom, uint32 color)
+{
+	if (Cull(min(left, right), min(top, bottom), max(left, right), max(top, bottom)))
+		return;
+
+	Push({ 0, nullptr, 0, left, top, right, bottom, 0, 0, color, DrawCommandType::DCT_Rect }, nullptr);
+}
+
+void DrawList::DrawCircle(int32 centerX, int32 centerY, int32 radius, uint32 color)
+{
+	if (Cull(centerX - radius, centerY - radius, centerX + radius + 1, centerY + radius + 1))
+		return;
+
+	Push({ 0, nullptr, 0, centerX, centerY, radius, 0, 0, 0, color, DrawCommandType::DCT_Circle }, nullptr);
+}
+
+void DrawList::DrawLine(int32 fromX, int32 fromY, int32 toX, int32 toY, uint32 color)
+{
+	if (Cull(min(fromX, toX), min(fromY, toY), max(fromX, toX) + 1, max(fromY, toY) + 1))
+		return;
+
+	Push({ 0, nullptr, 0, fromX, fromY, toX, toY, 0, 0, color, DrawCommandType::DCT_Line }, nullptr);
+}
+
+void DrawList::DrawText(int32 x, int32 y, const std::wstring& str, uint32 color)
+{
+	// 글자 크기는 target마다 다르므로 버리지 않는다.
+	_texts.push_back(str);
+	Push({ 0, nullptr, 0, x, y, static_cast<int32>(_texts.size()) - 1, 0, 0, 0, color, DrawCommandType::DCT_Text }, nullptr);
+}
+
+SIZE DrawList::GetTextSize(const std::wstring& str) const
+{
+	// 실제 크기는 Execute하는 target이 정한다. (GetBounds)
+	return { static_cast<LONG>(str.size()) * 8, 16 };
+}
+
+void DrawList::Push(DrawCommand command, const Texture* texture)
+{
+	command.texture = texture;
+	command.textureRevision = texture ? texture->GetRevision() : 0;
+	if (_sorted)
+		command.sortKey = MakeSortKey(_layer, _depth, texture ? texture->GetId() : NO_TEXTURE);
+	else
+		command.sortKey = MakeSortKey(_layer, 0.f, 0);
+	_commands.push_back(command);
+	_needSort = true;
+}
+
+void DrawList::Sort()
+{
+	if (_needSort == false)
+		return;
+
+	// 같은 key는 넣은 순서 유지
+	std::stable_sort(_commands.begin(), _commands.end(), [](const DrawCommand& a, const DrawCommand& b) {
+		return a.sortKey < b.sortKey;
+	});
+	_needSort = false;
+}
+
+void DrawList::Dispatch(RenderTarget& target, const DrawCommand& command) const
+{
+	switch (command.type) {
+	case DrawCommandType::DCT_Clear:
+		target.Clear(command.color);
+		break;
+	case DrawCommandType::DCT_Blit:
+		target.Blit(command.x, command.y, command.w, command.h, *command.texture, command.srcX, command.srcY);
+		break;
+	case DrawCommandType::DCT_BlitColorKey:
+		target.BlitColorKey(command.x, command.y, command.w, command.h, *command.texture, command.srcX, command.srcY);
+		break;
+	case DrawCommandType::DCT_BlitAlpha:
+		target.BlitAlpha(command.x, command.y, command.w, command.h, *command.texture, command.srcX, command.srcY, static_cast<uint8>(command.color));
+		break;
+	case DrawCommandType::DCT_Rect:
+		target.DrawRect(command.x, command.y, command.w, command.h, command.color);
+		break;
+	case DrawCommandType::DCT_Circle:
+		target.DrawCircle(command.x, command.y, command.w, command.color);
+		break;
+	case DrawCommandType::DCT_Line:
+		target.DrawLine(command.x, command.y, command.w, command.h, command.color);
+		break;
+	case DrawCommandType::DCT_Text:
+		target.DrawText(command.x, command.y, _texts[command.w], command.color);
+		break;
+	}
+}
+
+bool DrawList::Cull(int32 left, int32 top, int32 right, int32 bottom)
+{
+	if (right <= 0 || bottom <= 0 || left >= _width || top >= _height) {
+		++_stats.culled;
+		return true;
+	}
+	return false;
+}
@@ -0,0 +1,116 @@
+#pragma once
+#include "RenderTarget.h"
+
+enum class DrawCommandType : uint8 {
+	DCT_Clear,
+	DCT_Blit,
+	DCT_BlitColorKey,
+	DCT_BlitAlpha,
+	DCT_Rect,
+	DCT_Circle,
+	DCT_Line,
+	DCT_Text
+};
+
+/*
+	DrawCommand
+		- x, y, w, h의 의미는 type마다 다르다.
+			Blit = 출력 위치, 크기 (BlitAlpha의 color = opacity) / Rect = left, top, right, bottom / Circle = center, radius / Line = from, to / Text = 위치, w = text index
+		- sortKey = layer(8bit) | depth(24bit) | texture id(16bit) (작은 것부터 그린다)
+*/
+struct DrawCommand {
+	uint64 sortKey = 0;
+	const Texture* texture = nullptr;
+	uint32 textureRevision = 0;	// 넣을 때의 Texture::GetRevision (이전 frame과 비교)
+	int32 x = 0;
+	int32 y = 0;
+	int32 w = 0;
+	int32 h = 0;
+	int32 srcX = 0;
+	int32 srcY = 0;
+	uint32 color = 0;
+	DrawCommandType type = DrawCommandType::DCT_Clear;
+};
+
+struct DrawListStats {
+	int32 commands = 0;		// 실행한 수
+	int32 culled = 0;		// 화면 밖이라 버린 수
+	int32 textureSwitches = 0;	// 앞 명령과 texture가 다른 blit 수
+};
+
+/*
+	DrawList
+		- Actor의 Render가 바로 그리지 않고 명령만 모아두는 RenderTarget
+		- Execute에서 layer -> depth(Y) -> texture 순으로 정렬한 뒤 한번에 그린다.
+			같은 layer에서는 아래쪽(Y가 큰) Actor가 앞에 보이고, 같은 depth면 같은 texture끼리 이어서 그린다.
+			(background, UI처럼 넣은 순서가 중요한 layer는 sorted = false)
+		- 같은 key끼리는 넣은 순서를 유지한다. (Actor 하나의 sprite -> debug 도형 순서)
+		- 화면 밖의 blit, 도형은 넣을 때 버린다.
+		- clip은 기록하지 않는다. (Execute에서 clip을 넘긴다)
+*/
+class DrawList : public RenderTarget
+{
+public:
+	DrawList();
+	virtual ~DrawList();
+
+	// 한 frame 시작 (이전 명령은 지운다)
+	void Begin(int32 width, int32 height);
+	// 이후에 들어오는 명령의 layer (sorted = false면 depth, texture로 정렬하지 않고 넣은 순서대로 그린다)
+	void SetLayer(int32 layer, bool sorted) { _layer = layer; _sorted = sorted; }
+	// 이후에 들어오는 명령의 depth (보통 Actor의 Y)
+	void SetDepth(float depth) { _depth = depth; }
+
+	// 정렬해서 target에 그린다.
+	void Execute(RenderTarget& target);
+	// clip과 겹치는 명령만 clip 안에 그린다. (target의 clip은 설정해서 그린 뒤 되돌린다)
+	void Execute(RenderTarget& target, const RECT& clip);
+
+	// 명령이 target에 그리는 영역 (text 크기는 target마다 다르다)
+	RECT GetBounds(const DrawCommand& command, const RenderTarget& target) const;
+
+	// 그리는 순서로 정렬 (바뀐게 없으면 하지 않는다)
+	void Sort();
+	// 명령 하나를 target에 그린다. (Sort 이후 GetCommands 순서대로 호출하면 Execute와 같다)
+	void Dispatch(RenderTarget& target, const DrawCommand& command) const;
+
+	const std::vector<DrawCommand>& GetCommands() const { return _commands; }
+	const std::wstring& GetText(int32 index) const { return _texts[index]; }
+	const DrawListStats& GetStats() const { return _stats; }
+
+public:
+	virtual int32 GetWidth() const override { return _width; }
+	virtual int32 GetHeight() const override { return _height; }
+
+	virtual void Clear(uint32 color) override;
+	virtual void SetClipRect(const RECT* clip) override;
+
+	virtual void Blit(int32 x, int32 y, int32 w, int32 h, const Texture& texture, int32 srcX, int32 srcY) override;
+	virtual void BlitColorKey(int32 x, int32 y, int32 w, int32 h, const Texture& texture, int32 srcX, int32 srcY) override;
+	virtual void BlitAlpha(int32 x, int32 y, int32 w, int32 h, const Texture& texture, int32 srcX, int32 srcY, uint8 opacity) override;
+
+	virtual void DrawRect(int32 left, int32 top, int32 right, int32 bottom, uint32 color) override;
+	virtual void DrawCircle(int32 centerX, int32 centerY, int32 radius, uint32 color) override;
+	virtual void DrawLine(int32 fromX, int32 fromY, int32 toX, int32 toY, uint32 color) override;
+	virtual void DrawText(int32 x, int32 y, const std::wstring& str, uint32 color) override;
+	virtual SIZE GetTextSize(const std::wstring& str) const override;
+
+private:
+	// 현재 layer, depth로 key를 만들어 추가 (texture가 없는 명령은 같은 depth의 blit 뒤에)
+	void Push(DrawCommand command, const Texture* texture);
+	// [left, right) x [top, bottom)가 화면과 겹치지 않으면 버린다.
+	bool Cull(int32 left, int32 top, int32 right, int32 bottom);
+
+private:
+	int32 _width = 0;
+	int32 _height = 0;
+	int32 _layer = 0;
+	bool _sorted = false;
+	float _depth = 0.f;
+	bool _needSort = false;
+
+	std::vector<DrawCommand> _commands;
+	std::vector<std::wstring> _texts;
+	DrawListStats _stats;
+};
+
@@ -0,0 +1,399 @@
+#include "pch.h"
+#include "FrameBuffer.h"
+#include "Resources\Texture.h"
+#include "Utils\BlitUtils.h"
+
+namespace {
+	// ASCII 32(' ') ~ 126('~')의 8x14 bitmap font (한 줄 = 1byte, 왼쪽 pixel이 최상위 bit)
+	constexpr int32 GLYPH_WIDTH = 8;
+	constexpr int32 GLYPH_HEIGHT = 14;
+	constexpr wchar_t GLYPH_FIRST = L' ';
+	constexpr wchar_t GLYPH_LAST = L'~';
+
+	constexpr uint8 GLYPHS[GLYPH_LAST - GLYPH_FIRST + 1][GLYPH_HEIGHT] = {
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // ' '
+		{ 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00 }, // '!'
+		{ 0x00, 0x00, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // '"'
+		{ 0x00, 0x00, 0x00, 0x14, 0x14, 0x7E, 0x2C, 0x28, 0xFE, 0x48, 0x50, 0x00, 0x00, 0x00 }, // '#'
+		{ 0x00, 0x00, 0x10, 0x38, 0x74, 0x50, 0x30, 0x1C, 0x16, 0x54, 0x3C, 0x10, 0x10, 0x00 }, // '$'
+		{ 0x00, 0x00, 0x60, 0x90, 0x90, 0x66, 0x18, 0x4C, 0x12, 0x12, 0x0C, 0x00, 0x00, 0x00 }, // '%'
+		{ 0x00, 0x00, 0x38, 0x60, 0x60, 0x20, 0x70, 0xDA, 0xCE, 0x44, 0x7E, 0x00, 0x00, 0x00 }, // '&'
+		{ 0x00, 0x00, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // '''
+		{ 0x00, 0x08, 0x18, 0x10, 0x10, 0x30, 0x30, 0x30, 0x10, 0x10, 0x18, 0x08, 0x00, 0x00 }, // '('
+		{ 0x00, 0x20, 0x10, 0x10, 0x18, 0x18, 0x18, 0x18, 0x18, 0x10, 0x10, 0x20, 0x00, 0x00 }, // ')'
+		{ 0x00, 0x00, 0x10, 0x54, 0x38, 0x38, 0x54, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // '*'
+		{ 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0xFE, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00 }, // '+'
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x10, 0x30, 0x00, 0x00 }, // ','
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // '-'
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00 }, // '.'
+		{ 0x00, 0x00, 0x04, 0x0C, 0x08, 0x18, 0x10, 0x10, 0x20, 0x20, 0x60, 0x40, 0x00, 0x00 }, // '/'
+		{ 0x00, 0x00, 0x38, 0x6C, 0x44, 0x46, 0x56, 0x46, 0x44, 0x6C, 0x38, 0x00, 0x00, 0x00 }, // '0'
+		{ 0x00, 0x00, 0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x00, 0x00, 0x00 }, // '1'
+		{ 0x00, 0x00, 0x38, 0x4C, 0x04, 0x04, 0x08, 0x18, 0x30, 0x60, 0x7C, 0x00, 0x00, 0x00 }, // '2'
+		{ 0x00, 0x00, 0x38, 0x4C, 0x04, 0x0C, 0x38, 0x04, 0x04, 0x44, 0x78, 0x00, 0x00, 0x00 }, // '3'
+		{ 0x00, 0x00, 0x0C, 0x1C, 0x3C, 0x2C, 0x6C, 0x4C, 0xFE, 0x0C, 0x0C, 0x00, 0x00, 0x00 }, // '4'
+		{ 0x00, 0x00, 0x7C, 0x40, 0x40, 0x78, 0x0C, 0x04, 0x04, 0x4C, 0x78, 0x00, 0x00, 0x00 }, // '5'
+		{ 0x00, 0x00, 0x38, 0x64, 0x40, 0x78, 0x64, 0x44, 0x44, 0x64, 0x38, 0x00, 0x00, 0x00 }, // '6'
+		{ 0x00, 0x00, 0x7C, 0x04, 0x0C, 0x08, 0x08, 0x18, 0x10, 0x30, 0x20, 0x00, 0x00, 0x00 }, // '7'
+		{ 0x00, 0x00, 0x38, 0x64, 0x44, 0x64, 0x38, 0x44, 0x46, 0x64, 0x3C, 0x00, 0x00, 0x00 }, // '8'
+		{ 0x00, 0x00, 0x38, 0x6C, 0x44, 0x44, 0x6C, 0x3C, 0x04, 0x4C, 0x38, 0x00, 0x00, 0x00 }, // '9'
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00 }, // ':'
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x18, 0x10, 0x30, 0x00, 0x00 }, // ';'
+		{ 0x00, 0x00, 0x00, 0x00, 0x06, 0x1C, 0x60, 0x60, 0x1C, 0x06, 0x00, 0x00, 0x00, 0x00 }, // '<'
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00 }, // '='
+		{ 0x00, 0x00, 0x00, 0x00, 0xC0, 0x70, 0x0E, 0x0E, 0x70, 0xC0, 0x00, 0x00, 0x00, 0x00 }, // '>'
+		{ 0x00, 0x00, 0x38, 0x4C, 0x04, 0x08, 0x10, 0x10, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00 }, // '?'
+		{ 0x00, 0x00, 0x00, 0x3C, 0x66, 0x42, 0x9E, 0xB2, 0xB2, 0x9E, 0x40, 0x60, 0x3C, 0x00 }, // '@'
+		{ 0x00, 0x00, 0x18, 0x38, 0x28, 0x28, 0x6C, 0x64, 0x7C, 0x46, 0xC2, 0x00, 0x00, 0x00 }, // 'A'
+		{ 0x00, 0x00, 0x78, 0x44, 0x44, 0x44, 0x7C, 0x44, 0x46, 0x46, 0x7C, 0x00, 0x00, 0x00 }, // 'B'
+		{ 0x00, 0x00, 0x3C, 0x64, 0x40, 0x40, 0x40, 0x40, 0x40, 0x64, 0x3C, 0x00, 0x00, 0x00 }, // 'C'
+		{ 0x00, 0x00, 0x78, 0x4C, 0x44, 0x46, 0x46, 0x46, 0x44, 0x4C, 0x78, 0x00, 0x00, 0x00 }, // 'D'
+		{ 0x00, 0x00, 0x7C, 0x40, 0x40, 0x40, 0x7C, 0x40, 0x40, 0x40, 0x7E, 0x00, 0x00, 0x00 }, // 'E'
+		{ 0x00, 0x00, 0x7E, 0x60, 0x60, 0x60, 0x7C, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00 }, // 'F'
+		{ 0x00, 0x00, 0x3C, 0x64, 0x40, 0x40, 0x4E, 0x46, 0x46, 0x66, 0x3C, 0x00, 0x00, 0x00 }, // 'G'
+		{ 0x00, 0x00, 0x46, 0x46, 0x46, 0x46, 0x7E, 0x46, 0x46, 0x46, 0x46, 0x00, 0x00, 0x00 }, // 'H'
+		{ 0x00, 0x00, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x00, 0x00, 0x00 }, // 'I'
+		{ 0x00, 0x00, 0x3C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x48, 0x78, 0x00, 0x00, 0x00 }, // 'J'
+		{ 0x00, 0x00, 0x46, 0x4C, 0x58, 0x70, 0x70, 0x58, 0x4C, 0x44, 0x46, 0x00, 0x00, 0x00 }, // 'K'
+		{ 0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x7E, 0x00, 0x00, 0x00 }, // 'L'
+		{ 0x00, 0x00, 0xC6, 0xE6, 0xEE, 0xEA, 0xDA, 0xD2, 0xC2, 0xC2, 0xC2, 0x00, 0x00, 0x00 }, // 'M'
+		{ 0x00, 0x00, 0x66, 0x66, 0x66, 0x56, 0x56, 0x5E, 0x4E, 0x4E, 0x46, 0x00, 0x00, 0x00 }, // 'N'
+		{ 0x00, 0x00, 0x38, 0x6C, 0x44, 0x46, 0x46, 0x46, 0x44, 0x6C, 0x38, 0x00, 0x00, 0x00 }, // 'O'
+		{ 0x00, 0x00, 0x7C, 0x46, 0x46, 0x46, 0x7C, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00 }, // 'P'
+		{ 0x00, 0x00, 0x38, 0x6C, 0x44, 0x46, 0x46, 0x46, 0x44, 0x6C, 0x38, 0x0C, 0x04, 0x00 }, // 'Q'
+		{ 0x00, 0x00, 0x78, 0x4C, 0x44, 0x4C, 0x78, 0x4C, 0x44, 0x46, 0x42, 0x00, 0x00, 0x00 }, // 'R'
+		{ 0x00, 0x00, 0x38, 0x64, 0x40, 0x60, 0x38, 0x04, 0x06, 0x44, 0x3C, 0x00, 0x00, 0x00 }, // 'S'
+		{ 0x00, 0x00, 0xFE, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00 }, // 'T'
+		{ 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x64, 0x38, 0x00, 0x00, 0x00 }, // 'U'
+		{ 0x00, 0x00, 0xC6, 0x46, 0x44, 0x64, 0x2C, 0x28, 0x28, 0x38, 0x18, 0x00, 0x00, 0x00 }, // 'V'
+		{ 0x00, 0x00, 0x82, 0x82, 0xD2, 0xDA, 0x7E, 0x6E, 0x6C, 0x6C, 0x64, 0x00, 0x00, 0x00 }, // 'W'
+		{ 0x00, 0x00, 0x46, 0x64, 0x28, 0x38, 0x18, 0x38, 0x2C, 0x44, 0xC6, 0x00, 0x00, 0x00 }, // 'X'
+		{ 0x00, 0x00, 0xC6, 0x44, 0x2C, 0x38, 0x18, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00 }, // 'Y'
+		{ 0x00, 0x00, 0x7E, 0x04, 0x0C, 0x08, 0x18, 0x30, 0x20, 0x60, 0x7E, 0x00, 0x00, 0x00 }, // 'Z'
+		{ 0x00, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x00, 0x00 }, // '['
+		{ 0x00, 0x00, 0x40, 0x60, 0x20, 0x20, 0x10, 0x10, 0x18, 0x08, 0x0C, 0x04, 0x00, 0x00 }, // '\'
+		{ 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0x00, 0x00 }, // ']'
+		{ 0x00, 0x00, 0x18, 0x2C, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // '^'
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE }, // '_'
+		{ 0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // '`'
+		{ 0x00, 0x00, 0x00, 0x00, 0x78, 0x04, 0x04, 0x3C, 0x44, 0x4C, 0x7C, 0x00, 0x00, 0x00 }, // 'a'
+		{ 0x00, 0x40, 0x40, 0x40, 0x78, 0x64, 0x46, 0x46, 0x46, 0x64, 0x78, 0x00, 0x00, 0x00 }, // 'b'
+		{ 0x00, 0x00, 0x00, 0x00, 0x3C, 0x20, 0x60, 0x40, 0x60, 0x20, 0x3C, 0x00, 0x00, 0x00 }, // 'c'
+		{ 0x00, 0x04, 0x04, 0x04, 0x3C, 0x6C, 0x44, 0x44, 0x44, 0x6C, 0x3C, 0x00, 0x00, 0x00 }, // 'd'
+		{ 0x00, 0x00, 0x00, 0x00, 0x38, 0x64, 0x46, 0x7E, 0x40, 0x64, 0x3C, 0x00, 0x00, 0x00 }, // 'e'
+		{ 0x00, 0x1C, 0x10, 0x10, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00 }, // 'f'
+		{ 0x00, 0x00, 0x00, 0x00, 0x3C, 0x6C, 0x44, 0x44, 0x44, 0x6C, 0x3C, 0x04, 0x4C, 0x38 }, // 'g'
+		{ 0x00, 0x40, 0x40, 0x40, 0x7C, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00 }, // 'h'
+		{ 0x00, 0x10, 0x00, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x7E, 0x00, 0x00, 0x00 }, // 'i'
+		{ 0x00, 0x18, 0x00, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x70 }, // 'j'
+		{ 0x00, 0x60, 0x60, 0x60, 0x64, 0x68, 0x70, 0x78, 0x68, 0x64, 0x66, 0x00, 0x00, 0x00 }, // 'k'
+		{ 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1C, 0x00, 0x00, 0x00 }, // 'l'
+		{ 0x00, 0x00, 0x00, 0x00, 0x7C, 0x56, 0x52, 0x52, 0x52, 0x52, 0x52, 0x00, 0x00, 0x00 }, // 'm'
+		{ 0x00, 0x00, 0x00, 0x00, 0x7C, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00 }, // 'n'
+		{ 0x00, 0x00, 0x00, 0x00, 0x38, 0x64, 0x44, 0x44, 0x44, 0x64, 0x38, 0x00, 0x00, 0x00 }, // 'o'
+		{ 0x00, 0x00, 0x00, 0x00, 0x78, 0x64, 0x44, 0x46, 0x44, 0x64, 0x78, 0x40, 0x40, 0x40 }, // 'p'
+		{ 0x00, 0x00, 0x00, 0x00, 0x3C, 0x6C, 0x44, 0x44, 0x44, 0x6C, 0x3C, 0x04, 0x04, 0x04 }, // 'q'
+		{ 0x00, 0x00, 0x00, 0x00, 0x3E, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00 }, // 'r'
+		{ 0x00, 0x00, 0x00, 0x00, 0x38, 0x64, 0x60, 0x38, 0x04, 0x44, 0x38, 0x00, 0x00, 0x00 }, // 's'
+		{ 0x00, 0x00, 0x30, 0x30, 0x7C, 0x30, 0x30, 0x30, 0x30, 0x10, 0x1C, 0x00, 0x00, 0x00 }, // 't'
+		{ 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x6C, 0x3C, 0x00, 0x00, 0x00 }, // 'u'
+		{ 0x00, 0x00, 0x00, 0x00, 0x46, 0x44, 0x64, 0x2C, 0x28, 0x38, 0x18, 0x00, 0x00, 0x00 }, // 'v'
+		{ 0x00, 0x00, 0x00, 0x00, 0x82, 0x82, 0xD2, 0x5E, 0x6C, 0x6C, 0x6C, 0x00, 0x00, 0x00 }, // 'w'
+		{ 0x00, 0x00, 0x00, 0x00, 0x44, 0x2C, 0x38, 0x18, 0x38, 0x6C, 0x46, 0x00, 0x00, 0x00 }, // 'x'
+		{ 0x00, 0x00, 0x00, 0x00, 0x46, 0x44, 0x64, 0x2C, 0x28, 0x38, 0x18, 0x10, 0x30, 0x60 }, // 'y'
+		{ 0x00, 0x00, 0x00, 0x00, 0x7C, 0x0C, 0x08, 0x10, 0x30, 0x60, 0x7C, 0x00, 0x00, 0x00 }, // 'z'
+		{ 0x00, 0x0C, 0x18, 0x10, 0x10, 0x10, 0x70, 0x10, 0x10, 0x10, 0x18, 0x0C, 0x00, 0x00 }, // '{'
+		{ 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00 }, // '|'
+		{ 0x00, 0x70, 0x10, 0x10, 0x10, 0x18, 0x0C, 0x18, 0x10, 0x10, 0x10, 0x70, 0x00, 0x00 }, // '}'
+		{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // '~'
+	};
+}
+
+FrameBuffer::FrameBuffer(int32 width, int32 height)
+{
+	Resize(width, height);
+}
+
+FrameBuffer::FrameBuffer(FrameBuffer& parent, const RECT& clip) :
+	_width(parent._width), _height(parent._height), _data(parent._data), _view(true)
+{
+	// parent의 clip 안으로 제한
+	_limit = parent._clip;
+	SetClipRect(&clip);
+	_limit = _clip;
+}
+
+FrameBuffer::~FrameBuffer()
+{
+}
+
+void FrameBuffer::Resize(int32 width, int32 height)
+{
+	if (_view)
+		return;
+
+	_width = max(0, width);
+	_height = max(0, height);
+	_pixels.assign(static_cast<size_t>(_width) * _height, 0);
+	_data = _pixels.data();
+	_limit = { 0, 0, _width, _height };
+	SetClipRect(nullptr);
+}
+
+uint32 FrameBuffer::GetPixel(int32 x, int32 y) const
+{
+	if (x < 0 || y < 0 || x >= _width || y >= _height)
+		return 0;
+	return _data[static_cast<size_t>(y) * _width + x];
+}
+
+bool FrameBuffer::SaveBmp(const std::wstring& path) const
+{
+	std::ofstream file(fs::path(path), std::ios::binary);
+	if (file.is_open() == false)
+		return false;
+
+	const uint32 imageSize = static_cast<uint32>(static_cast<size_t>(_width) * _height * sizeof(uint32));
+
+	BITMAPFILEHEADER fileHeader = {};
+	fileHeader.bfType = 0x4D42; // "BM"
+	fileHeader.bfOffBits = sizeof(BITMAPFILEHEADER) + sizeof(BITMAPINFOHEADER);
+	fileHeader.bfSize = fileHeader.bfOffBits + imageSize;
+
+	// height가 음수 = 위에서 아래로
+	BITMAPINFOHEADER infoHeader = {};
+	infoHeader.biSize = sizeof(BITMAPINFOHEADER);
+	infoHeader.biWidth = _width;
+	infoHeader.biHeight = -_height;
+	infoHeader.biPlanes = 1;
+	infoHeader.biBitCount = 32;
+	infoHeader.biCompression = BI_RGB;
+	infoHeader.biSizeImage = imageSize;
+
+	file.write(reinterpret_cast<const char*>(&fileHeader), sizeof(fileHeader));
+	file.write(reinterpret_cast<const char*>(&infoHeader), sizeof(infoHeader));
+	file.write(reinterpret_cast<const char*>(_data), imageSize);
+
+	return file.good();
+}
+
+void FrameBuffer::Clear(uint32 color)
+{
+	const uint32 pixel = BlitUtils::ToPixel(color);
+	for (int32 y = _clip.top; y < _clip.bottom; ++y)
+		FillSpan(y, _clip.left, _clip.right - 1, pixel);
+}
+
+void FrameBuffer::SetClipRect(const RECT* clip)
+{
+	_clip = _limit;
+	if (clip == nullptr)
+		return;
+
+	_clip.left = std::clamp<LONG>(clip->left, _limit.left, _limit.right);
+	_clip.top = std::clamp<LONG>(clip->top, _limit.top, _limit.bottom);
+	_clip.right = std::clamp<LONG>(clip->right, _clip.left, _limit.right);
+	_clip.bottom = std::clamp<LONG>(clip->bottom, _clip.top, _limit.bottom);
+}
+
+void FrameBuffer::Blit(int32 x, int32 y, int32 w, int32 h, const Texture& texture, int32 srcX, int32 srcY)
+{
+	if (ClipBlit(x, y, w, h, srcX, srcY) == false)
+		return;
+
+	BlitUtils::Blit(_data, _width, _height, x, y,
+		texture.GetPixels(), texture.GetWidth(), texture.GetHeight(), srcX, srcY, w, h);
+}
+
+void FrameBuffer::BlitColorKey(int32 x, int32 y, int32 w, int32 h, const Texture& texture, int32 srcX, int32 srcY)
+{
+	// 반투명한 pixel은 섞는다. (alpha가 0, 255뿐이면 구간 복사와 같다)
+	if (texture.GetAlpha() == TextureAlpha::TA_Blend) {
+		BlitAlpha(x, y, w, h, texture, srcX, srcY, 255);
+		return;
+	}
+
+	if (ClipBlit(x, y, w, h, srcX, srcY) == false)
+		return;
+
+	// Load할 때 구해둔 구간이 있으면 key 비교 없이 복사
+	const ColorKeySpans& spans = texture.GetSpans();
+	if (spans.IsEmpty() == false) {
+		BlitUtils::BlitSpans(_data, _width, _height, x, y,
+			texture.GetPixels(), texture.GetWidth(), texture.GetHeight(), srcX, srcY, w, h, spans);
+		return;
+	}
+
+	BlitUtils::BlitColorKey(_data, _width, _height, x, y,
+		texture.GetPixels(), texture.GetWidth(), texture.GetHeight(), srcX, srcY, w, h, BlitUtils::ToPixel(texture.GetTransparent()));
+}
+
+void FrameBuffer::BlitAlpha(int32 x, int32 y, int32 w, int32 h, const Texture& texture, int32 srcX, int32 srcY, uint8 opacity)
+{
+	if (opacity == 0)
+		return;
+
+	// 섞을 필요가 없으면 복사
+	const TextureAlpha alpha = texture.GetAlpha();
+	if (opacity == 255 && alpha == TextureAlpha::TA_Opaque) {
+		Blit(x, y, w, h, texture, srcX, srcY);
+		return;
+	}
+	if (opacity == 255 && alpha != TextureAlpha::TA_Blend) {
+		BlitColorKey(x, y, w, h, texture, srcX, srcY);
+		return;
+	}
+
+	if (ClipBlit(x, y, w, h, srcX, srcY) == false)
+		return;
+
+	// alpha가 없으면 transparent 색이 아닌 구간을 불투명(alpha 255)하게 섞는다.
+	BlitUtils::BlitBlend(_data, _width, _height, x, y,
+		texture.GetPixels(), texture.GetWidth(), texture.GetHeight(), srcX, srcY, w, h,
+		texture.GetSpans(), opacity, texture.HasAlpha() ? 0 : 0xFF000000);
+}
+
+void FrameBuffer::DrawRect(int32 left, int32 top, int32 right, int32 bottom, uint32 color)
+{
+	if (left > right)
+		std::swap(left, right);
+	if (top > bottom)
+		std::swap(top, bottom);
+	if (left == right || top == bottom)
+		return;
+
+	const uint32 pixel = BlitUtils::ToPixel(color);
+	FillSpan(top, left, right - 1, pixel);
+	FillSpan(bottom - 1, left, right - 1, pixel);
+	FillColumn(left, top, bottom - 1, pixel);
+	FillColumn(right - 1, top, bottom - 1, pixel);
+}
+
+void FrameBuffer::DrawCircle(int32 centerX, int32 centerY, int32 radius, uint32 color)
+{
+	if (radius < 0)
+		return;
+
+	// Midpoint circle : 1/8 원을 구해서 대칭으로 그린다.
+	const uint32 pixel = BlitUtils::ToPixel(color);
+	int32 x = radius;
+	int32 y = 0;
+	int32 error = 1 - radius;
+	while (x >= y) {
+		SetPixel(centerX + x, centerY + y, pixel);
+		SetPixel(centerX - x, centerY + y, pixel);
+		SetPixel(centerX + x, centerY - y, pixel);
+		SetPixel(centerX - x, centerY - y, pixel);
+		SetPixel(centerX + y, centerY + x, pixel);
+		SetPixel(centerX - y, centerY + x, pixel);
+		SetPixel(centerX + y, centerY - x, pixel);
+		SetPixel(centerX - y, centerY - x, pixel);
+
+		++y;
+		if (error < 0) {
+			error += 2 * y + 1;
+		}
+		else {
+			--x;
+			error += 2 * (y - x) + 1;
+		}
+	}
+}
+
+void FrameBuffer::DrawLine(int32 fromX, int32 fromY, int32 toX, int32 toY, uint32 color)
+{
+	// Bresenham, 끝점은 그리지 않는다. (::LineTo와 같다)
+	const uint32 pixel = BlitUtils::ToPixel(color);
+	const int32 dx = std::abs(toX - fromX);
+	const int32 dy = -std::abs(toY - fromY);
+	const int32 stepX = fromX < toX ? 1 : -1;
+	const int32 stepY = fromY < toY ? 1 : -1;
+	int32 error = dx + dy;
+
+	while (fromX != toX || fromY != toY) {
+		SetPixel(fromX, fromY, pixel);
+
+		const int32 error2 = error * 2;
+		if (error2 >= dy) {
+			error += dy;
+			fromX += stepX;
+		}
+		if (error2 <= dx) {
+			error += dx;
+			fromY += stepY;
+		}
+	}
+}
+
+void FrameBuffer::DrawText(int32 x, int32 y, const std::wstring& str, uint32 color)
+{
+	const uint32 pixel = BlitUtils::ToPixel(color);
+	for (wchar_t ch : str) {
+		// font에 없는 글자는 '?'
+		if (ch < GLYPH_FIRST || ch > GLYPH_LAST)
+			ch = L'?';
+
+		const uint8* glyph = GLYPHS[ch - GLYPH_FIRST];
+		for (int32 row = 0; row < GLYPH_HEIGHT; ++row) {
+			if (glyph[row] == 0)
+				continue;
+			for (int32 col = 0; col < GLYPH_WIDTH; ++col) {
+				if (glyph[row] & (0x80 >> col))
+					SetPixel(x + col, y + row, pixel);
+			}
+		}
+
+		x += GLYPH_WIDTH;
+	}
+}
+
+SIZE FrameBuffer::GetTextSize(const std::wstring& str) const
+{
+	return { static_cast<LONG>(str.size()) * GLYPH_WIDTH, GLYPH_HEIGHT };
+}
+
+void FrameBuffer::FillSpan(int32 y, int32 fromX, int32 toX, uint32 pixel)
+{
+	if (y < _clip.top || y >= _clip.bottom)
+		return;
+
+	fromX = max(fromX, static_cast<int32>(_clip.left));
+	toX = min(toX, static_cast<int32>(_clip.right) - 1);
+	if (fromX > toX)
+		return;
+
+	uint32* row = &_data[static_cast<size_t>(y) * _width];
+	std::fill(row + fromX, row + toX + 1, pixel);
+}
+
+void FrameBuffer::FillColumn(int32 x, int32 fromY, int32 toY, uint32 pixel)
+{
+	if (x < _clip.left || x >= _clip.right)
+		return;
+
+	fromY = max(fromY, static_cast<int32>(_clip.top));
+	toY = min(toY, static_cast<int32>(_clip.bottom) - 1);
+	for (int32 y = fromY; y <= toY; ++y)
+		_data[static_cast<size_t>(y) * _width + x] = pixel;
+}
+
+bool FrameBuffer::ClipBlit(int32& x, int32& y, int32& w, int32& h, int32& srcX, int32& srcY) const
+{
+	// 잘린 만큼 src 시작점도 옮긴다.
+	if (x < _clip.left) {
+		const int32 cut = _clip.left - x;
+		x += cut;
+		srcX += cut;
+		w -= cut;
+	}
+	if (y < _clip.top) {
+		const int32 cut = _clip.top - y;
+		y += cut;
+		srcY += cut;
+		h -= cut;
+	}
+	w = min(w, static_cast<int32>(_clip.right) - x);
+	h = min(h, static_cast<int32>(_clip.bottom) - y);
+
+	return w > 0 && h > 0;
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include "RenderTarget.h"
+
+/*
+	FrameBuffer
+		- CPU 메모리에 그리는 32bit RenderTarget (GDI를 사용하지 않는다)
+		- pixel = 0x00RRGGBB, 위에서 아래로 (32bit top-down DIB와 같은 배치라 그대로 창에 복사할 수 있다)
+		- 화면(SetClipRect가 있으면 clip) 밖으로 나가는 부분은 잘라서 그린다.
+		- view = 다른 FrameBuffer의 pixel을 공유 (clip 밖은 건드리지 않으므로 서로 다른 clip의 view는 여러 thread에서 동시에 그릴 수 있다)
+*/
+class FrameBuffer : public RenderTarget
+{
+public:
+	FrameBuffer(int32 width, int32 height);
+	// parent의 pixel에 clip 안만 그리는 view (parent보다 먼저 없어져야 한다)
+	FrameBuffer(FrameBuffer& parent, const RECT& clip);
+	virtual ~FrameBuffer();
+
+	// 복사하면 _data가 원본의 pixel을 가리키므로 막는다.
+	FrameBuffer(const FrameBuffer&) = delete;
+	FrameBuffer& operator=(const FrameBuffer&) = delete;
+
+	// view는 크기를 바꿀 수 없다.
+	void Resize(int32 width, int32 height);
+
+	const uint32* GetPixels() const { return _data; }
+	uint32 GetPixel(int32 x, int32 y) const;
+
+	// 결과 확인용 (32bit BMP)
+	bool SaveBmp(const std::wstring& path) const;
+
+public:
+	virtual int32 GetWidth() const override { return _width; }
+	virtual int32 GetHeight() const override { return _height; }
+
+	virtual void Clear(uint32 color) override;
+	virtual void SetClipRect(const RECT* clip) override;
+
+	virtual void Blit(int32 x, int32 y, int32 w, int32 h, const Texture& texture, int32 srcX, int32 srcY) override;
+	virtual void BlitColorKey(int32 x, int32 y, int32 w, int32 h, const Texture& texture, int32 srcX, int32 srcY) override;
+	virtual void BlitAlpha(int32 x, int32 y, int32 w, int32 h, const Texture& texture, int32 srcX, int32 srcY, uint8 opacity) override;
+
+	virtual void DrawRect(int32 left, int32 top, int32 right, int32 bottom, uint32 color) override;
+	virtual void DrawCircle(int32 centerX, int32 centerY, int32 radius, uint32 color) override;
+	virtual void DrawLine(int32 fromX, int32 fromY, int32 toX, int32 toY, uint32 color) override;
+	virtual void DrawText(int32 x, int32 y, const std::wstring& str, uint32 color) override;
+	virtual SIZE GetTextSize(const std::wstring& str) const override;
+
+private:
+	// clip 밖이면 무시
+	void SetPixel(int32 x, int32 y, uint32 pixel) {
+		if (x < _clip.left || y < _clip.top || x >= _clip.right || y >= _clip.bottom)
+			return;
+		_data[static_cast<size_t>(y) * _width + x] = pixel;
+	}
+	// [fromX, toX] 가로줄
+	void FillSpan(int32 y, int32 fromX, int32 toX, uint32 pixel);
+	// [fromY, toY] 세로줄
+	void FillColumn(int32 x, int32 fromY, int32 toY, uint32 pixel);
+	// blit 영역을 clip 안으로 자른다. (화면 밖은 BlitUtils에서 자른다, 그릴 부분이 없으면 false)
+	bool ClipBlit(int32& x, int32& y, int32& w, int32& h, int32& srcX, int32& srcY) const;
+
+private:
+	int32 _width = 0;
+	int32 _height = 0;
+	std::vector<uint32> _pixels;	// view면 비어있다.
+	uint32* _data = nullptr;		// 그리는 곳 (_pixels 또는 parent의 pixel)
+	bool _view = false;
+	RECT _clip = {};		// 항상 _limit 안 (SetClipRect(nullptr) = _limit 전체)
+	RECT _limit = {};		// 화면 전체, view면 만들 때의 clip
+};
+
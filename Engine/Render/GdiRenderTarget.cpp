@@ -0,0 +1,120 @@
+#include "pch.h"
+#include "GdiRenderTarget.h"
+#include "Resources\Texture.h"
+
+GdiRenderTarget::GdiRenderTarget(HDC hdc, int32 width, int32 height) :
+	_hdc(hdc), _width(width), _height(height)
+{
+	// 펜 색만 바꿔서 사용 (DC_PEN), 도형 내부는 채우지 않는다.
+	::SelectObject(_hdc, ::GetStockObject(DC_PEN));
+	::SelectObject(_hdc, ::GetStockObject(NULL_BRUSH));
+	::SetBkMode(_hdc, TRANSPARENT);
+}
+
+GdiRenderTarget::~GdiRenderTarget()
+{
+}
+
+void GdiRenderTarget::Clear(uint32 color)
+{
+	RECT rect = { 0, 0, _width, _height };
+	::SetDCBrushColor(_hdc, color);
+	::FillRect(_hdc, &rect, (HBRUSH)::GetStockObject(DC_BRUSH));
+}
+
+void GdiRenderTarget::SetClipRect(const RECT* clip)
+{
+	if (clip == nullptr) {
+		::SelectClipRgn(_hdc, NULL);
+		return;
+	}
+
+	// DC가 region을 복사해서 가지므로 바로 지운다.
+	HRGN region = ::CreateRectRgn(clip->left, clip->top, clip->right, clip->bottom);
+	::SelectClipRgn(_hdc, region);
+	::DeleteObject(region);
+}
+
+void GdiRenderTarget::Blit(int32 x, int32 y, int32 w, int32 h, const Texture& texture, int32 srcX, int32 srcY)
+{
+	if (texture.GetDC() == NULL)
+		return;
+
+	::BitBlt(_hdc, x, y, w, h, texture.GetDC(), srcX, srcY, SRCCOPY);
+}
+
+void GdiRenderTarget::BlitColorKey(int32 x, int32 y, int32 w, int32 h, const Texture& texture, int32 srcX, int32 srcY)
+{
+	if (texture.GetDC() == NULL)
+		return;
+
+	// alpha가 있으면 transparent 색 대신 alpha로
+	if (texture.HasAlpha()) {
+		BlitAlpha(x, y, w, h, texture, srcX, srcY, 255);
+		return;
+	}
+
+	::TransparentBlt(_hdc,
+		// 이미지 출력 위치, 크기
+		x, y, w, h,
+		// 이미지의 핸들
+		texture.GetDC(),
+		// 이미지에서 가져올 시작지점, 크기
+		srcX, srcY, w, h,
+		texture.GetTransparent());
+}
+
+void GdiRenderTarget::BlitAlpha(int32 x, int32 y, int32 w, int32 h, const Texture& texture, int32 srcX, int32 srcY, uint8 opacity)
+{
+	if (opacity == 0 || texture.GetDC() == NULL)
+		return;
+
+	// 섞을 필요가 없으면 BitBlt, TransparentBlt
+	if (opacity == 255 && texture.GetAlpha() == TextureAlpha::TA_Opaque) {
+		Blit(x, y, w, h, texture, srcX, srcY);
+		return;
+	}
+	if (opacity == 255 && texture.HasAlpha() == false) {
+		BlitColorKey(x, y, w, h, texture, srcX, srcY);
+		return;
+	}
+
+	// AC_SRC_ALPHA = premultiplied 32bit DIB의 alpha 사용, SourceConstantAlpha = opacity
+	BLENDFUNCTION blend = {};
+	blend.BlendOp = AC_SRC_OVER;
+	blend.SourceConstantAlpha = opacity;
+	blend.AlphaFormat = AC_SRC_ALPHA;
+	::AlphaBlend(_hdc, x, y, w, h, texture.GetBlendDC(), srcX, srcY, w, h, blend);
+}
+
+void GdiRenderTarget::DrawRect(int32 left, int32 top, int32 right, int32 bottom, uint32 color)
+{
+	::SetDCPenColor(_hdc, color);
+	::Rectangle(_hdc, left, top, right, bottom);
+}
+
+void GdiRenderTarget::DrawCircle(int32 centerX, int32 centerY, int32 radius, uint32 color)
+{
+	::SetDCPenColor(_hdc, color);
+	::Ellipse(_hdc, centerX - radius, centerY - radius, centerX + radius, centerY + radius);
+}
+
+void GdiRenderTarget::DrawLine(int32 fromX, int32 fromY, int32 toX, int32 toY, uint32 color)
+{
+	::SetDCPenColor(_hdc, color);
+	::MoveToEx(_hdc, fromX, fromY, nullptr);
+	::LineTo(_hdc, toX, toY);
+}
+
+void GdiRenderTarget::DrawText(int32 x, int32 y, const std::wstring& str, uint32 color)
+{
+	::SetTextColor(_hdc, color);
+	::TextOut(_hdc, x, y, str.c_str(), static_cast<int32>(str.size()));
+}
+
+SIZE GdiRenderTarget::GetTextSize(const std::wstring& str) const
+{
+	SIZE size = {};
+	::GetTextExtentPoint32(_hdc, str.c_str(), static_cast<int32>(str.size()), &size);
+	return size;
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include "RenderTarget.h"
+
+// 기존 GDI 렌더링 (EngineWindow의 back buffer DC에 그린다)
+class GdiRenderTarget : public RenderTarget
+{
+public:
+	GdiRenderTarget(HDC hdc, int32 width, int32 height);
+	virtual ~GdiRenderTarget();
+
+	virtual int32 GetWidth() const override { return _width; }
+	virtual int32 GetHeight() const override { return _height; }
+
+	virtual void Clear(uint32 color) override;
+	virtual void SetClipRect(const RECT* clip) override;
+
+	virtual void Blit(int32 x, int32 y, int32 w, int32 h, const Texture& texture, int32 srcX, int32 srcY) override;
+	virtual void BlitColorKey(int32 x, int32 y, int32 w, int32 h, const Texture& texture, int32 srcX, int32 srcY) override;
+	virtual void BlitAlpha(int32 x, int32 y, int32 w, int32 h, const Texture& texture, int32 srcX, int32 srcY, uint8 opacity) override;
+
+	virtual void DrawRect(int32 left, int32 top, int32 right, int32 bottom, uint32 color) override;
+	virtual void DrawCircle(int32 centerX, int32 centerY, int32 radius, uint32 color) override;
+	virtual void DrawLine(int32 fromX, int32 fromY, int32 toX, int32 toY, uint32 color) override;
+	virtual void DrawText(int32 x, int32 y, const std::wstring& str, uint32 color) override;
+	virtual SIZE GetTextSize(const std::wstring& str) const override;
+
+private:
+	HDC _hdc = {};
+	int32 _width = 0;
+	int32 _height = 0;
+};
+
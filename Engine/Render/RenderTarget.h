@@ -0,0 +1,40 @@
+#pragma once
+
+class Texture;
+
+/*
+	RenderTarget
+		- Level, Actor, Component는 HDC 대신 이것으로 그린다.
+		- GdiRenderTarget = 창의 back buffer (HDC), FrameBuffer = CPU 메모리 (창 없이 렌더링, 측정 가능)
+		- 좌표는 화면 좌표 (왼쪽 상단 기준), 색은 RGB()
+*/
+class RenderTarget
+{
+public:
+	virtual ~RenderTarget() {}
+
+	virtual int32 GetWidth() const = 0;
+	virtual int32 GetHeight() const = 0;
+
+	virtual void Clear(uint32 color) = 0;
+
+	// 이후 그리기(Clear 포함)를 clip 안으로 제한 (nullptr = 전체)
+	virtual void SetClipRect(const RECT* clip) = 0;
+
+	// texture의 (srcX, srcY)부터 w x h 만큼을 (x, y)에 그대로 복사 (BitBlt)
+	virtual void Blit(int32 x, int32 y, int32 w, int32 h, const Texture& texture, int32 srcX, int32 srcY) = 0;
+	// Blit과 같지만 texture의 transparent 색은 그리지 않는다. (TransparentBlt)
+	virtual void BlitColorKey(int32 x, int32 y, int32 w, int32 h, const Texture& texture, int32 srcX, int32 srcY) = 0;
+	// texture의 alpha(premultiplied)에 opacity(0 ~ 255)를 곱해서 섞는다. (AlphaBlend, alpha가 없으면 transparent 색을 뺀 나머지)
+	virtual void BlitAlpha(int32 x, int32 y, int32 w, int32 h, const Texture& texture, int32 srcX, int32 srcY, uint8 opacity) = 0;
+
+	// 테두리만 그린다. (right, bottom은 포함하지 않는다, ::Rectangle과 같다)
+	virtual void DrawRect(int32 left, int32 top, int32 right, int32 bottom, uint32 color) = 0;
+	virtual void DrawCircle(int32 centerX, int32 centerY, int32 radius, uint32 color) = 0;
+	virtual void DrawLine(int32 fromX, int32 fromY, int32 toX, int32 toY, uint32 color) = 0;
+	// 배경은 그리지 않는다.
+	virtual void DrawText(int32 x, int32 y, const std::wstring& str, uint32 color) = 0;
+	// DrawText로 그려지는 크기
+	virtual SIZE GetTextSize(const std::wstring& str) const = 0;
+};
+
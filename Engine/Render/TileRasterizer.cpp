@@ -0,0 +1,67 @@
+#include "pch.h"
+#include "TileRasterizer.h"
+#include "DrawList.h"
+#include "FrameBuffer.h"
+#include "Manager\ThreadManager.h"
+
+void TileRasterizer::Execute(DrawList& drawList, FrameBuffer& target, const RECT& clip, uint32 background)
+{
+	const RECT screen = { 0, 0, target.GetWidth(), target.GetHeight() };
+	RECT area;
+	if (::IntersectRect(&area, &clip, &screen) == FALSE)
+		return;
+
+	drawList.Sort();
+
+	// area를 덮는 tile (화면의 tile 격자 기준)
+	const int32 startX = area.left / _tileWidth;
+	const int32 startY = area.top / _tileHeight;
+	const int32 countX = (area.right - 1) / _tileWidth - startX + 1;
+	const int32 countY = (area.bottom - 1) / _tileHeight - startY + 1;
+	const int32 tileCount = countX * countY;
+
+	if (static_cast<int32>(_bins.size()) < tileCount)
+		_bins.resize(tileCount);
+	for (int32 i = 0; i < tileCount; ++i)
+		_bins[i].clear();
+
+	// 명령이 걸치는 tile마다 넣는다. (정렬 순서대로 넣으므로 bin 안도 정렬되어 있다)
+	_stats = {};
+	const std::vector<DrawCommand>& commands = drawList.GetCommands();
+	for (int32 i = 0; i < static_cast<int32>(commands.size()); ++i) {
+		const RECT bounds = drawList.GetBounds(commands[i], target);
+		RECT visible;
+		if (::IntersectRect(&visible, &bounds, &area) == FALSE)
+			continue;
+
+		const int32 fromX = visible.left / _tileWidth - startX;
+		const int32 toX = (visible.right - 1) / _tileWidth - startX;
+		const int32 fromY = visible.top / _tileHeight - startY;
+		const int32 toY = (visible.bottom - 1) / _tileHeight - startY;
+		for (int32 y = fromY; y <= toY; ++y) {
+			for (int32 x = fromX; x <= toX; ++x)
+				_bins[y * countX + x].push_back(i);
+		}
+		_stats.binned += (toX - fromX + 1) * (toY - fromY + 1);
+	}
+
+	// 한 번에 여러 tile을 가져가서 ParallelFor의 동기화 비용을 줄인다.
+	const int32 grainSize = max(1, tileCount / (GET_SINGLE(ThreadManager)->GetThreadCount() * 4));
+	GET_SINGLE(ThreadManager)->ParallelFor(tileCount, grainSize, [&](int32 begin, int32 end) {
+		for (int32 i = begin; i < end; ++i) {
+			const int32 x = startX + i % countX;
+			const int32 y = startY + i / countX;
+			const RECT tile = { x * _tileWidth, y * _tileHeight, (x + 1) * _tileWidth, (y + 1) * _tileHeight };
+			RECT tileClip;
+			::IntersectRect(&tileClip, &tile, &area);
+
+			FrameBuffer view(target, tileClip);
+			view.Clear(background);
+			for (int32 index : _bins[i])
+				drawList.Dispatch(view, commands[index]);
+		}
+	});
+
+	_stats.tiles = tileCount;
+	_stats.threads = GET_SINGLE(ThreadManager)->GetThreadCount();
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+class DrawList;
+class FrameBuffer;
+
+struct TileRasterizerStats {
+	int32 tiles = 0;		// 그린 tile 수
+	int32 binned = 0;		// tile마다 넣은 명령 수의 합 (여러 tile에 걸친 명령은 여러번)
+	int32 threads = 1;
+};
+
+/*
+	TileRasterizer
+		- DrawList의 명령을 화면 tile(기본 512x32)별로 나눠 담고, tile마다 따로 FrameBuffer에 그린다.
+			가로로 잘리면 sprite의 줄마다 구간을 다시 찾고 복사를 나눠야 하므로 넓고 낮은 tile이 빠르다. (1080p = 136개)
+		- tile은 ThreadManager::ParallelFor로 여러 thread에서 동시에 그린다.
+			tile마다 clip이 다른 FrameBuffer view를 사용하므로 서로 같은 pixel을 쓰지 않는다.
+		- tile 안에서는 DrawList의 정렬 순서대로 그리므로 한 thread에서 Execute한 결과와 같다.
+*/
+class TileRasterizer
+{
+public:
+	// tile 크기 (pixel)
+	void SetTileSize(int32 width, int32 height) {
+		_tileWidth = max(8, width);
+		_tileHeight = max(8, height);
+	}
+	int32 GetTileWidth() const { return _tileWidth; }
+	int32 GetTileHeight() const { return _tileHeight; }
+
+	// clip 안을 background로 지우고 drawList를 그린다.
+	void Execute(DrawList& drawList, FrameBuffer& target, const RECT& clip, uint32 background);
+
+	const TileRasterizerStats& GetStats() const { return _stats; }
+
+private:
+	int32 _tileWidth = 512;
+	int32 _tileHeight = 32;
+
+	// tile마다 그릴 명령의 index (정렬 순서), 매 frame 재사용
+	std::vector<std::vector<int32>> _bins;
+	TileRasterizerStats _stats;
+};
+
@@ -7,8 +7,64 @@ Flipbook::Flipbook()
 
 Flipbook::Flipbook(const FlipbookInfo& info) : _info(info)
 {
+	TrimFrames();
 }
 
 Flipbook::~Flipbook()
 {
 }
+
+void Flipbook::SetInfo(const FlipbookInfo& info)
+{
+	_info = info;
+	TrimFrames();
+}
+
+void Flipbook::TrimFrames()
+{
+	_frames.clear();
+	if (_info.texture == nullptr)
+		return;
+
+	const Texture& texture = *_info.texture;
+	const ColorKeySpans& spans = texture.GetSpans();
+	const int32 frameWidth = static_cast<int32>(_info.spriteSize.X);
+	const int32 frameHeight = static_cast<int32>(_info.spriteSize.Y);
+
+	for (int32 i = _info.start; i <= _info.end; ++i) {
+		// 잘라내기 전의 frame 영역 (texture 밖은 제외)
+		const int32 cellX = i * frameWidth;
+		const int32 cellY = _info.line * frameHeight;
+		const int32 cellEndX = min(cellX + frameWidth, texture.GetWidth());
+		const int32 cellEndY = min(cellY + frameHeight, texture.GetHeight());
+
+		int32 minX = INT32_MAX;
+		int32 minY = INT32_MAX;
+		int32 maxX = INT32_MIN;
+		int32 maxY = INT32_MIN;
+		for (int32 y = cellY; y < cellEndY && spans.IsEmpty() == false; ++y) {
+			for (uint32 k = spans.rowOffsets[y]; k < spans.rowOffsets[y + 1]; ++k) {
+				const int32 from = max(static_cast<int32>(spans.spans[k].start), cellX);
+				const int32 to = min(spans.spans[k].start + spans.spans[k].length, cellEndX);
+				if (from >= to)
+					continue;
+
+				minX = min(minX, from);
+				maxX = max(maxX, to);
+				minY = min(minY, y);
+				maxY = max(maxY, y + 1);
+			}
+		}
+
+		FlipbookFrame frame;
+		if (minX < maxX) {
+			frame.srcX = minX;
+			frame.srcY = minY;
+			frame.width = maxX - minX;
+			frame.height = maxY - minY;
+			frame.offsetX = minX - cellX;
+			frame.offsetY = minY - cellY;
+		}
+		_frames.push_back(frame);
+	}
+}
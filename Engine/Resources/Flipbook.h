@@ -7,11 +7,21 @@ struct FlipbookInfo {
 	Vector2D spriteSize = Vector2D::Zero;
 	int32 start = 0;
 	int32 end = 0;
-	int32 line = 0; // texture ° ٿ ִ
+	int32 line = 0; // texture의 몇번째 줄에 있는지
 	float duration = 1.f;
 	bool loop = true;
 };
 
+// Frame에서 투명하지 않은 부분만 잘라낸 영역 (SetInfo할 때 구한다)
+struct FlipbookFrame {
+	int32 srcX = 0;		// texture에서 가져올 시작지점
+	int32 srcY = 0;
+	int32 width = 0;	// 잘라낸 크기 (모두 투명하면 0)
+	int32 height = 0;
+	int32 offsetX = 0;	// 원래 frame(spriteSize)의 왼쪽 상단에서 떨어진 거리
+	int32 offsetY = 0;
+};
+
 class Flipbook
 {
 public:
@@ -20,10 +30,18 @@ public:
 	~Flipbook();
 
 public:
-	virtual void SetInfo(const FlipbookInfo& info) { _info = info; }
+	virtual void SetInfo(const FlipbookInfo& info);
 	const FlipbookInfo& GetInfo() const { return _info; }
 
+	// info.start ~ info.end 순서 (FlipbookActor의 idx)
+	const std::vector<FlipbookFrame>& GetFrames() const { return _frames; }
+
+private:
+	// texture의 ColorKeySpans로 frame마다 투명하지 않은 영역을 구한다.
+	void TrimFrames();
+
 private:
 	FlipbookInfo _info;
+	std::vector<FlipbookFrame> _frames;
 };
 
@@ -11,11 +11,6 @@ Sprite::~Sprite()
 {
 }
 
-HDC Sprite::GetDC()
-{
-	return _texture->GetDC();
-}
-
 int32 Sprite::GetTransparent()
 {
 	return _texture->GetTransparent();
@@ -11,7 +11,7 @@ public:
 public:
 	void SetTexture(std::shared_ptr<Texture> texture) { _texture = std::move(texture); }
 
-	HDC GetDC();
+	std::shared_ptr<Texture> GetTexture() const { return _texture; }
 	int32 GetTransparent();
 	
 	Vector2D GetSpritePos() const { return _spritePos; }
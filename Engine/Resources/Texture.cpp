@@ -1,38 +1,272 @@
 #include "pch.h"
 #include "Texture.h"
+#include <wincodec.h>
+#include <wrl\client.h>
+
+// PNG (WIC) 사용
+#pragma comment(lib, "windowscodecs.lib")
+
+namespace {
+	// 위에서 아래로 (height가 음수), pixel은 CPU쪽과 같은 형식인 DIB section을 만들어 DC에 선택
+	bool CreateDibDC(HDC compatible, int32 width, int32 height, const uint32* pixels, HDC& hdc, HBITMAP& bitmap)
+	{
+		hdc = ::CreateCompatibleDC(compatible);
+
+		BITMAPINFO info = {};
+		info.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+		info.bmiHeader.biWidth = width;
+		info.bmiHeader.biHeight = -height;
+		info.bmiHeader.biPlanes = 1;
+		info.bmiHeader.biBitCount = 32;
+		info.bmiHeader.biCompression = BI_RGB;
+
+		void* bits = nullptr;
+		bitmap = ::CreateDIBSection(hdc, &info, DIB_RGB_COLORS, &bits, nullptr, 0);
+		if (bitmap == NULL) {
+			::DeleteDC(hdc);
+			hdc = {};
+			return false;
+		}
+		::memcpy(bits, pixels, static_cast<size_t>(width) * height * sizeof(uint32));
+
+		HBITMAP prev = (HBITMAP)::SelectObject(hdc, bitmap); // 새로 생성된 dc로 교체
+		::DeleteObject(prev); // 기존 dc 삭제
+		return true;
+	}
+}
 
 Texture::Texture()
 {
+	// UINT16_MAX는 texture가 없는 명령이 사용
+	_id = _nextId;
+	_nextId = (_nextId + 1) % UINT16_MAX;
 }
 
 Texture::~Texture()
 {
+	ReleaseGdiBitmap();
 }
 
 bool Texture::LoadBmp(HWND hwnd, const std::wstring& path)
 {
-	HDC hdc = ::GetDC(hwnd); //  Texture ׸ DC 
+	// ::LoadImage 대신 직접 읽어서 창(GDI) 없이도 pixel을 사용할 수 있게
+	std::ifstream file(fs::path(path), std::ios::binary);
+
+	BITMAPFILEHEADER fileHeader = {};
+	BITMAPINFOHEADER infoHeader = {};
+	file.read(reinterpret_cast<char*>(&fileHeader), sizeof(fileHeader));
+	file.read(reinterpret_cast<char*>(&infoHeader), sizeof(infoHeader));
+
+	const bool supported = file.good() && fileHeader.bfType == 0x4D42 /* "BM" */
+		&& (infoHeader.biBitCount == 24 || infoHeader.biBitCount == 32) && infoHeader.biCompression == BI_RGB
+		&& infoHeader.biWidth > 0 && infoHeader.biHeight != 0;
+	if (supported == false) {
+		::MessageBox(hwnd, path.c_str(), L"Image Load Failed", NULL);
+		return false;
+	}
 
-	_hdc = ::CreateCompatibleDC(hdc);
+	// height가 양수면 아래에서 위로 저장되어 있다.
+	const int32 width = infoHeader.biWidth;
+	const int32 height = std::abs(infoHeader.biHeight);
+	const bool bottomUp = infoHeader.biHeight > 0;
+	const int32 bytesPerPixel = infoHeader.biBitCount / 8;
+	const int32 stride = (width * bytesPerPixel + 3) & ~3; // 한 줄은 4byte 단위
 
-	_bitmap = (HBITMAP)::LoadImage(nullptr, path.c_str(), IMAGE_BITMAP, 0, 0, LR_LOADFROMFILE | LR_CREATEDIBSECTION | LR_DEFAULTSIZE);
-	if (_bitmap == NULL) {
+	std::vector<uint8> data(static_cast<size_t>(stride) * height);
+	file.seekg(fileHeader.bfOffBits);
+	file.read(reinterpret_cast<char*>(data.data()), data.size());
+	if (file.good() == false) {
 		::MessageBox(hwnd, path.c_str(), L"Image Load Failed", NULL);
 		return false;
 	}
 
-	HBITMAP prev = (HBITMAP)::SelectObject(_hdc, _bitmap); //   dc ü
-	::DeleteObject(prev); //  dc 
+	// 32bit라도 4번째 byte는 보통 사용하지 않으므로(0) 하나라도 값이 있을 때만 alpha로 본다.
+	bool alpha = false;
+	std::vector<uint32> pixels(static_cast<size_t>(width) * height);
+	for (int32 y = 0; y < height; ++y) {
+		const uint8* src = &data[static_cast<size_t>(bottomUp ? height - 1 - y : y) * stride];
+		uint32* dest = &pixels[static_cast<size_t>(y) * width];
+		for (int32 x = 0; x < width; ++x, src += bytesPerPixel) {
+			const uint32 a = bytesPerPixel == 4 ? src[3] : 0;
+			dest[x] = (a << 24) | (static_cast<uint32>(src[2]) << 16) | (static_cast<uint32>(src[1]) << 8) | src[0];
+			alpha |= a != 0;
+		}
+	}
+
+	// BMP의 alpha는 RGB에 곱해져 있지 않다.
+	if (alpha) {
+		for (uint32& pixel : pixels)
+			pixel = BlitUtils::Premultiply(pixel);
+	}
+	else {
+		for (uint32& pixel : pixels)
+			pixel &= 0x00FFFFFF;
+	}
+
+	return Create(hwnd, width, height, std::move(pixels), alpha);
+}
+
+bool Texture::LoadPng(HWND hwnd, const std::wstring& path)
+{
+	using Microsoft::WRL::ComPtr;
+
+	// 이미 초기화된 thread면 S_FALSE (짝을 맞춰 CoUninitialize), 다른 방식으로 초기화되어 있으면 실패해도 그대로 사용
+	const HRESULT com = ::CoInitializeEx(nullptr, COINIT_APARTMENTTHREADED);
+
+	UINT width = 0;
+	UINT height = 0;
+	std::vector<uint32> pixels;
+	bool loaded = false;
+	{
+		ComPtr<IWICImagingFactory> factory;
+		ComPtr<IWICBitmapDecoder> decoder;
+		ComPtr<IWICBitmapFrameDecode> frame;
+		ComPtr<IWICBitmapSource> converted;
+
+		// premultiplied BGRA = little endian uint32로 0xAARRGGBB
+		loaded = SUCCEEDED(::CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER, IID_PPV_ARGS(&factory)))
+			&& SUCCEEDED(factory->CreateDecoderFromFilename(path.c_str(), nullptr, GENERIC_READ, WICDecodeMetadataCacheOnDemand, &decoder))
+			&& SUCCEEDED(decoder->GetFrame(0, &frame))
+			&& SUCCEEDED(::WICConvertBitmapSource(GUID_WICPixelFormat32bppPBGRA, frame.Get(), &converted))
+			&& SUCCEEDED(converted->GetSize(&width, &height))
+			&& width > 0 && height > 0;
+
+		if (loaded) {
+			pixels.resize(static_cast<size_t>(width) * height);
+			loaded = SUCCEEDED(converted->CopyPixels(nullptr, width * sizeof(uint32),
+				static_cast<UINT>(pixels.size() * sizeof(uint32)), reinterpret_cast<BYTE*>(pixels.data())));
+		}
+	}
+
+	if (SUCCEEDED(com))
+		::CoUninitialize();
+
+	if (loaded == false) {
+		::MessageBox(hwnd, path.c_str(), L"Image Load Failed", NULL);
+		return false;
+	}
+
+	return Create(hwnd, static_cast<int32>(width), static_cast<int32>(height), std::move(pixels), true);
+}
+
+bool Texture::Create(HWND hwnd, int32 width, int32 height, std::vector<uint32> pixels, bool alpha)
+{
+	if (width <= 0 || height <= 0 || pixels.size() != static_cast<size_t>(width) * height)
+		return false;
+
+	_width = width;
+	_height = height;
+	_pixels = std::move(pixels);
+	_size.X = static_cast<float>(width);
+	_size.Y = static_cast<float>(height);
+	_revision = ++_nextRevision;
+	_alpha = TextureAlpha::TA_ColorKey;
+	if (alpha)
+		UpdateAlpha();
+
+	if (hwnd)
+		CreateGdiBitmap(hwnd);
+
+	BuildSpans();
 
-	BITMAP bitMap = {};
-	::GetObject(_bitmap, sizeof(BITMAP), &bitMap); // ε ̹  
-	_size.X = static_cast<float>(bitMap.bmWidth);
-	_size.Y = static_cast<float>(bitMap.bmHeight);
-	
 	return true;
 }
 
-HDC Texture::GetDC()
+void Texture::SetTransparent(uint32 transparent)
+{
+	if (_transparent == transparent)
+		return;
+
+	_transparent = transparent;
+
+	// alpha가 있으면 transparent 색은 사용하지 않는다.
+	if (HasAlpha())
+		return;
+
+	_revision = ++_nextRevision;
+	BuildSpans();
+
+	// transparent 색으로 만든 DC는 다시 만든다.
+	ReleaseBlendBitmap();
+}
+
+HDC Texture::GetBlendDC() const
 {
-	return _hdc;
+	if (HasAlpha() || _hdc == NULL)
+		return _hdc;
+	if (_blendHdc)
+		return _blendHdc;
+
+	// transparent 색 = 0 (alpha 0), 나머지 = alpha 255
+	const uint32 key = BlitUtils::ToPixel(_transparent);
+	std::vector<uint32> pixels(_pixels.size());
+	for (size_t i = 0; i < _pixels.size(); ++i)
+		pixels[i] = _pixels[i] == key ? 0 : (_pixels[i] | 0xFF000000);
+
+	if (CreateDibDC(_hdc, _width, _height, pixels.data(), _blendHdc, _blendBitmap) == false)
+		return _hdc;
+
+	return _blendHdc;
+}
+
+void Texture::BuildSpans()
+{
+	if (_pixels.empty())
+		return;
+
+	if (HasAlpha())
+		_spans.BuildAlpha(_pixels.data(), _width, _height);
+	else
+		_spans.Build(_pixels.data(), _width, _height, BlitUtils::ToPixel(_transparent));
+}
+
+void Texture::UpdateAlpha()
+{
+	bool opaque = true;
+	bool binary = true;
+	for (uint32 pixel : _pixels) {
+		const uint32 a = pixel >> 24;
+		opaque &= a == 0xFF;
+		binary &= a == 0xFF || a == 0;
+	}
+
+	if (opaque)
+		_alpha = TextureAlpha::TA_Opaque;
+	else if (binary)
+		_alpha = TextureAlpha::TA_Binary;
+	else
+		_alpha = TextureAlpha::TA_Blend;
+}
+
+void Texture::CreateGdiBitmap(HWND hwnd)
+{
+	ReleaseGdiBitmap();
+
+	HDC hdc = ::GetDC(hwnd); // 이 Texture를 그릴 DC 생성
+	CreateDibDC(hdc, _width, _height, _pixels.data(), _hdc, _bitmap);
+	::ReleaseDC(hwnd, hdc);
+}
+
+void Texture::ReleaseGdiBitmap()
+{
+	if (_hdc)
+		::DeleteDC(_hdc);
+	if (_bitmap)
+		::DeleteObject(_bitmap);
+
+	_hdc = {};
+	_bitmap = {};
+
+	ReleaseBlendBitmap();
+}
+
+void Texture::ReleaseBlendBitmap()
+{
+	if (_blendHdc)
+		::DeleteDC(_blendHdc);
+	if (_blendBitmap)
+		::DeleteObject(_blendBitmap);
+
+	_blendHdc = {};
+	_blendBitmap = {};
 }
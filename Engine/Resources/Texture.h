@@ -1,29 +1,90 @@
 #pragma once
+#include "Utils\BlitUtils.h"
 
+// pixel의 alpha를 어떻게 사용하는지 (pixel을 만들 때 정한다)
+enum class TextureAlpha : uint8 {
+	TA_ColorKey,	// alpha 없음 (0x00RRGGBB), transparent 색만 그리지 않는다.
+	TA_Opaque,		// alpha가 모두 255 (그대로 복사)
+	TA_Binary,		// alpha가 0 또는 255 (구간만 복사)
+	TA_Blend,		// 반투명한 pixel이 있다. (dest와 섞는다)
+};
+
+/*
+	Texture
+		- pixel은 CPU 메모리에 32bit (0x00RRGGBB, 위에서 아래로)로 가지고 있는다. (FrameBuffer에서 사용)
+		- alpha가 있으면 premultiplied (0xAARRGGBB, RGB에 alpha를 미리 곱한 값)
+		- 창이 있으면 GDI에서 그릴 수 있도록 같은 pixel로 DIB section과 DC도 만든다.
+		- Load할 때 transparent가 아닌(alpha가 0이 아닌) 구간(ColorKeySpans)을 미리 구해서 그릴 때 key 비교를 하지 않는다.
+*/
 class Texture
 {
 public:
 	Texture();
 	virtual ~Texture();
 
+	// 24/32bit 압축하지 않은 BMP만 (hwnd가 없으면 GDI용 DC는 만들지 않는다)
+	// 32bit의 4번째 byte가 모두 0이 아니면 alpha로 사용한다.
 	bool LoadBmp(HWND hwnd, const std::wstring& path);
+	// WIC로 읽는다. (JPG 등 WIC가 지원하는 다른 형식도 가능, 항상 alpha 사용)
+	bool LoadPng(HWND hwnd, const std::wstring& path);
+	// pixel로 직접 만들기 (alpha = false면 0x00RRGGBB, true면 premultiplied 0xAARRGGBB)
+	bool Create(HWND hwnd, int32 width, int32 height, std::vector<uint32> pixels, bool alpha = false);
 
 public:
-	HDC GetDC();
+	HDC GetDC() const { return _hdc; }
+	// ::AlphaBlend에 넘길 premultiplied DC (alpha가 없으면 transparent 색을 alpha 0으로 바꾼 DC를 처음 사용할 때 만든다)
+	HDC GetBlendDC() const;
+	// DrawList에서 같은 texture끼리 모아 그릴 때 사용
+	uint16 GetId() const { return _id; }
+	// pixel이 바뀔 때마다 (LoadBmp, Create, SetTransparent) 새 값 (모든 Texture에서 겹치지 않는다)
+	uint32 GetRevision() const { return _revision; }
 
 	void SetSize(Vector2D size) { _size = size; }
 	Vector2D GetSize() const { return _size; }
 
-	void SetTransparent(uint32 transparent) { _transparent = transparent;	}
+	int32 GetWidth() const { return _width; }
+	int32 GetHeight() const { return _height; }
+	const uint32* GetPixels() const { return _pixels.data(); }
+
+	// 바뀌면 구간을 다시 구한다. (Load 전에 설정하면 한번만 구한다)
+	void SetTransparent(uint32 transparent);
 	uint32 GetTransparent() const { return _transparent; }
 
+	const ColorKeySpans& GetSpans() const { return _spans; }
+
+	TextureAlpha GetAlpha() const { return _alpha; }
+	bool HasAlpha() const { return _alpha != TextureAlpha::TA_ColorKey; }
+
 private:
+	void CreateGdiBitmap(HWND hwnd);
+	void ReleaseGdiBitmap();
+	void ReleaseBlendBitmap();
+	void BuildSpans();
+	// alpha를 보고 TA_Opaque, TA_Binary, TA_Blend 중 하나로
+	void UpdateAlpha();
+
+private:
+	static inline uint16 _nextId = 0;
+	uint16 _id = 0;
+	static inline uint32 _nextRevision = 0;
+	uint32 _revision = 0;
+
 	HDC _hdc = {};
 	HBITMAP _bitmap = {};
+	// GetBlendDC에서 만든다. (alpha가 없는 texture만)
+	mutable HDC _blendHdc = {};
+	mutable HBITMAP _blendBitmap = {};
 	Vector2D _size = {};
-	//  ϴ ̹ bit  24bit̹Ƿ RGB, ̹  RGBAϼ ִ.
-	// ̹ RGBA Ʈ ϸ ʿ RGBϸ ʿ
-	uint32 _transparent = RGB(255, 0, 255); //  Ȱϴ  ʱ⼳
+
+	int32 _width = 0;
+	int32 _height = 0;
+	std::vector<uint32> _pixels;
+	ColorKeySpans _spans;
+	TextureAlpha _alpha = TextureAlpha::TA_ColorKey;
+
+	// 지금 사용하는 이미지의 bit 수준이 24bit이므로 RGB사용, 이미지에 따라 RGBA일수도 있다.
+	// 이미지가 RGBA 비트를 사용하면 필요없지만 RGB사용하면 필요
+	uint32 _transparent = RGB(255, 0, 255); // 거의 활용안하는 색으로 초기설정
 
 };
 
@@ -11,11 +11,11 @@ Tilemap::~Tilemap()
 
 bool Tilemap::LoadFile(const std::wstring& path)
 {
-	// txt Ͽ 
+	// txt 파일에 저장
 	{
 		std::wifstream ifs;
 
-		ifs.open(path, std::ios::out); //   
+		ifs.open(path, std::ios::out); // 내용이 있으면 지운다
 		if (ifs.fail())
 			return false;
 
@@ -40,7 +40,7 @@ bool Tilemap::LoadFile(const std::wstring& path)
 
 void Tilemap::SaveFile(const std::wstring& path)
 {
-	// Txt 
+	// Txt 파일
 	{
 		std::wofstream ofs;
 
@@ -59,7 +59,7 @@ void Tilemap::SaveFile(const std::wstring& path)
 	}
 }
 
-// TODO: ȭ ʿ
+// TODO: 최적화 필요
 bool Tilemap::CanGo(Vector2D cellPos)
 {
 	if (_tiles.empty())
@@ -69,17 +69,108 @@ bool Tilemap::CanGo(Vector2D cellPos)
 	if (tile == nullptr)
 		return false;
 
-	// TODO: Tile struct̳ TileInfo struct/bit  ϰ parameter ޾
-	// ִ Ȯ  ϱ
+	// TODO: Tile struct이나 TileInfo struct/bit를 새로 생성하고 parameter로 받아
+	// 갈수있는지 확인할 용으로 사용하기
 
-	//   ƴ Ȯ
+	// 현재는 벽이 아닌지만 확인
 	return tile->value != 1;
 }
 
-// Mapsize / tilesize =>  tile (mapsize.x * mapsize.y)
+namespace {
+	// 벽에 딱 붙어 있을때 float 오차로 벽 tile과 겹친 것으로 보지 않도록 사용하는 여유 (pixel)
+	constexpr float SWEEP_SKIN = 0.001f;
+
+	// [minValue, maxValue] 구간이 걸친 tile index 범위 (move 방향으로 경계에 닿은 tile은 들어가는 중이므로 포함)
+	void GetCellRange(float minValue, float maxValue, float move, float tileSize, int32& first, int32& last)
+	{
+		first = static_cast<int32>(std::floor((minValue + SWEEP_SKIN) / tileSize));
+		last = static_cast<int32>(std::ceil((maxValue - SWEEP_SKIN) / tileSize)) - 1;
+
+		if (move > 0.f)
+			last = static_cast<int32>(std::floor((maxValue + SWEEP_SKIN) / tileSize));
+		else if (move < 0.f)
+			first = static_cast<int32>(std::ceil((minValue - SWEEP_SKIN) / tileSize)) - 1;
+	}
+}
+
+TileSweepResult Tilemap::SweepBox(const Vector2D& center, const Vector2D& halfSize, const Vector2D& move)
+{
+	TileSweepResult result;
+	result.move = move;
+
+	if (_tileSize <= 0 || (move.X == 0.f && move.Y == 0.f))
+		return result;
+
+	const float tileSize = static_cast<float>(_tileSize);
+
+	const float boxMin[2] = { center.X - halfSize.X, center.Y - halfSize.Y };
+	const float boxMax[2] = { center.X + halfSize.X, center.Y + halfSize.Y };
+	const float moves[2] = { move.X, move.Y };
+
+	// 축마다 이동 방향 쪽 모서리가 다음 tile 경계를 넘는 시간 (Amanatides-Woo)
+	int32 step[2] = {};
+	int32 nextCell[2] = {};
+	float nextTime[2] = { FLT_MAX, FLT_MAX };
+	float deltaTime[2] = { FLT_MAX, FLT_MAX };
+
+	for (int32 axis = 0; axis < 2; ++axis) {
+		if (moves[axis] == 0.f)
+			continue;
+
+		float boundary = 0.f;
+		if (moves[axis] > 0.f) {
+			step[axis] = 1;
+			nextCell[axis] = static_cast<int32>(std::ceil((boxMax[axis] - SWEEP_SKIN) / tileSize));
+			boundary = nextCell[axis] * tileSize;
+			nextTime[axis] = (boundary - boxMax[axis]) / moves[axis];
+		}
+		else {
+			step[axis] = -1;
+			nextCell[axis] = static_cast<int32>(std::floor((boxMin[axis] + SWEEP_SKIN) / tileSize)) - 1;
+			boundary = (nextCell[axis] + 1) * tileSize;
+			nextTime[axis] = (boundary - boxMin[axis]) / moves[axis];
+		}
+		deltaTime[axis] = tileSize / std::abs(moves[axis]);
+	}
+
+	// 먼저 넘는 경계부터 새로 들어간 tile 줄(열)만 검사
+	while (true) {
+		const int32 axis = nextTime[0] <= nextTime[1] ? 0 : 1;
+		const float time = nextTime[axis];
+		if (time > 1.f)
+			break;
+
+		// 그 순간 다른 축으로 걸친 tile 범위
+		const int32 other = 1 - axis;
+		int32 first = 0, last = 0;
+		GetCellRange(boxMin[other] + moves[other] * time, boxMax[other] + moves[other] * time, moves[other], tileSize, first, last);
+
+		for (int32 i = first; i <= last; ++i) {
+			const Vector2D cellPos = axis == 0 ? Vector2D(static_cast<float>(nextCell[0]), static_cast<float>(i))
+				: Vector2D(static_cast<float>(i), static_cast<float>(nextCell[1]));
+			if (CanGo(cellPos))
+				continue;
+
+			result.blocked = true;
+			result.cellPos = cellPos;
+			result.normal = axis == 0 ? Vector2D(static_cast<float>(-step[0]), 0.f) : Vector2D(0.f, static_cast<float>(-step[1]));
+			result.time = max(0.f, time);
+			result.move = move * result.time;
+			return result;
+		}
+
+		nextCell[axis] += step[axis];
+		nextTime[axis] += deltaTime[axis];
+	}
+
+	return result;
+}
+
+// Mapsize / tilesize => 맵의 tile 개수(mapsize.x * mapsize.y)
 void Tilemap::SetMapSize(const Vector2D& size)
 {
 	_mapSize = size;
+	++_revision;
 
 	_tiles = std::vector<std::vector<Tile>>(static_cast<int32>(size.Y), std::vector<Tile>(static_cast<int32>(size.X)));
 
@@ -1,10 +1,19 @@
 #pragma once
 
 struct Tile {
-	// TODO: ŸϿ   (ex: objectType, tileType etc)
+	// TODO: 타일에 들어갈 정보 (ex: objectType, tileType etc)
 	int32 value = 0;
 };
 
+// Tilemap 위에서 사각형을 이동시킨 결과 (Tilemap::SweepBox)
+struct TileSweepResult {
+	bool blocked = false;				// 이동 중 갈 수 없는 tile에 막혔는지
+	Vector2D cellPos = Vector2D::Zero;	// 처음 막힌 tile (blocked일때만)
+	Vector2D normal = Vector2D::Zero;	// 막힌 면에서 바깥쪽 방향
+	float time = 1.f;					// 이동할 수 있는 비율 (0 ~ 1)
+	Vector2D move = Vector2D::Zero;		// 실제로 이동할 수 있는 만큼
+};
+
 class Tilemap
 {
 public:
@@ -15,8 +24,12 @@ public:
 	void SaveFile(const std::wstring& path);
 
 	bool CanGo(Vector2D cellPos);
+
+	// center(Tilemap 기준 좌표, 왼쪽 상단 = 0)의 사각형을 move만큼 이동할때 처음 막히는 tile (DDA)
+	// 시작할때 이미 겹쳐있는 tile은 막지 않는다. (벽에서 빠져나올 수 있도록)
+	TileSweepResult SweepBox(const Vector2D& center, const Vector2D& halfSize, const Vector2D& move);
 public:
-	// Mapsize / tilesize =>  tile (mapsize.x * mapsize.y)
+	// Mapsize / tilesize => 맵의 tile 개수(mapsize.x * mapsize.y)
 	void SetMapSize(const Vector2D& size);
 	Vector2D GetMapSize() const {	return _mapSize; }
 	
@@ -26,10 +39,14 @@ public:
 	Tile* GetTileAt(const Vector2D& pos);
 	std::vector<std::vector<Tile>>& GetTiles() { return _tiles; }
 
+	// 맵 전체가 바뀔 때마다 (SetMapSize, LoadFile) 증가 (미리 그려둔 tile을 다시 만들어야 하는지 확인)
+	uint32 GetRevision() const { return _revision; }
+
 private:
 	Vector2D _mapSize = {};
-	// TODO: vector2D   ִ°    .
+	// TODO: vector2D 값으로 가지고 있는게 더 좋ㅇ르 것 같다.
 	int32 _tileSize = {};
 	std::vector<std::vector<Tile>> _tiles;
+	uint32 _revision = 0;
 };
 
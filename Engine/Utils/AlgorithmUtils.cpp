@@ -6,8 +6,8 @@
 
 bool AlgorithmUtils::FindPathAStar(const Vector2D& src, Vector2D dest, std::vector<Vector2D>& path, int32 maxDepth)
 {
-    //  ʹ Ŀ ָ   귮 ް þ⿡ maxDepth 
-    int32 depth = MathUtils::Manhattan(src, dest); // 뷫 ߵǴ Ÿ
+    // 맵이 너무 커서 멀리 가야할 경우 계산량이 급격히 늘어나기에 maxDepth로 제한
+    int32 depth = MathUtils::Manhattan(src, dest); // 대략적으로 가야되는 거리
     if (depth >= maxDepth)
         return false;
 
@@ -19,10 +19,10 @@ bool AlgorithmUtils::FindPathAStar(const Vector2D& src, Vector2D dest, std::vect
     };
 
     std::priority_queue<PQNode, std::vector<PQNode>, std::greater<PQNode>> pq;
-    std::map<Vector2D, int32> best; // 湮   üũ ÿ ϴ°Ͱ .
+    std::map<Vector2D, int32> best; // 방문한 곳과 비용 체크를 동시에 하는것과 같다.
     std::map<Vector2D, Vector2D> parent;
 
-    // ʱⰪ
+    // 초기값
     {
         int32 cost = MathUtils::Manhattan(src, dest);
         pq.push({ cost, src});
@@ -32,46 +32,46 @@ bool AlgorithmUtils::FindPathAStar(const Vector2D& src, Vector2D dest, std::vect
 
     bool found = false;
     while (pq.empty() == false) {
-        //   ĺ ã
+        // 제일 좋은 후보 찾기
         PQNode node = pq.top();
         pq.pop();
 
-        //  ª θ ãҴٸ ŵ
+        // 더 짧은 경로를 찾았다면 스킵
         if (best[node.pos] < node.cost)
             continue;
 
-        //   ٷ 
+        // 목적지에 도착했으면 바로 종료
         if (node.pos == dest)
         {
             found = true;
             break;
         }
 
-        // 湮
+        // 방문
         for (int32 dir = 0; dir < 4; ++dir) {
             Vector2D nextPos = node.pos + front[dir];
 
-            // ִ Ȯ
+            // 갈수있는지 확인
             std::shared_ptr<Tilemap> tilemap = World::GetCurrentLevel()->GetCurTilemap();
             if (tilemap && tilemap->CanGo(nextPos) == false) 
                 continue;
             
-            //    ʹ ָ  ʴ´.
-            int32 depth = MathUtils::Manhattan(src, nextPos); // ±  Ÿ (AStar ˰򿡼 G)
+            // 갈 수 있지만 너무 멀면 가지 않는다.
+            int32 depth = MathUtils::Manhattan(src, nextPos); // 여태까지 온 거리 (AStar 알고리즘에선 G값)
             if (depth >= maxDepth)
                 continue;
 
-            int32 cost = MathUtils::Manhattan(nextPos, dest); //  ߵ  
+            int32 cost = MathUtils::Manhattan(nextPos, dest); // 앞으로 가야될 예상 비용
             int32 bestCost = best[nextPos];
             
-            // ̹ 湮߾ٸ
+            // 이미 방문했었다면
             if (bestCost != 0) {
-                // ٸ ο    ã ŵ
+                // 다른 경로에서 더 빠른 길을 찾았으면 스킵
                 if (bestCost <= cost)
                     continue;
             }
 
-            //  
+            // 예약 진행
             best[nextPos] = cost;
             pq.push({ cost, nextPos });
             parent[nextPos] = node.pos;
@@ -79,21 +79,21 @@ bool AlgorithmUtils::FindPathAStar(const Vector2D& src, Vector2D dest, std::vect
         }
     }
 
-    //     ִ  ġ ̵
+    // 목적지까지 갈 길이 없으니 최대한 가까운 위치로 이동
     if (found == false) {
-        //  ó   cost   ó ġ ã
+        // 목적지 근처로 가기 위해 cost가 가장 적은 근처 위치 찾기
         int32 bestCost = INT32_MAX;
         for (auto& [pos, cost] : best) {
-            // ̶,  ġ   ̵ϴ  
+            // 동점이라면, 최초 위치에서 가장 덜 이동하는 쪽으로 
             if (bestCost == cost) {
-                //  ġ    ġ ã
+                // 두 위치 중 더 가까운 위치 찾기
                 int32 dist1 = MathUtils::Manhattan(src, dest);
                 int32 dist2 = MathUtils::Manhattan(src, pos);
                 
                 if (dist1 > dist2)
                     dest = pos;
             }
-            //   cost
+            // 더 작은 cost
             else if (cost < bestCost) {
                 dest = pos;
                 bestCost = cost;
@@ -104,11 +104,11 @@ bool AlgorithmUtils::FindPathAStar(const Vector2D& src, Vector2D dest, std::vect
     path.clear();
     Vector2D pos = dest;
 
-    //    ġ Ųٷ ö󰣴.
+    // 도착지에서 시작해 시작 위치로 거꾸로 올라간다.
     while (true) {
         path.push_back(pos);
 
-        // 
+        // 시작점
         if (pos == parent[pos])
             break;
 
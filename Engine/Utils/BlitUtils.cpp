@@ -0,0 +1,396 @@
+#include "pch.h"
+#include "BlitUtils.h"
+#include "CpuFeatures.h"
+#include <immintrin.h>
+
+namespace {
+	/*
+		row 함수에서 사용하는 SIMD 연산 (같은 kernel 코드를 AVX2 = 8개, SSE2 = 4개씩으로 빌드, CollisionUtils와 같다)
+			- 어느 쪽을 실행할지는 CpuFeatures::GetSimd()로 고른다.
+			- blend는 pixel의 byte를 16bit로 늘려서 계산한다.
+	*/
+#if defined(SIMD_BUILD_AVX2)
+	struct SimdAvx2 {
+		static constexpr int32 WIDTH = 8;
+		static constexpr int32 FULL_MASK = 0xFF;
+		using uint32N = __m256i;
+
+		static uint32N Load(const uint32* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+		static void Store(uint32* p, uint32N v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+		static uint32N Set1(uint32 value) { return _mm256_set1_epi32(static_cast<int32>(value)); }
+		static uint32N Equal(uint32N a, uint32N b) { return _mm256_cmpeq_epi32(a, b); }
+		// mask가 켜진 곳은 a, 아니면 b
+		static uint32N Select(uint32N mask, uint32N a, uint32N b) { return _mm256_blendv_epi8(b, a, mask); }
+		static int32 MoveMask(uint32N mask) { return _mm256_movemask_ps(_mm256_castsi256_ps(mask)); }
+
+		static uint32N Zero() { return _mm256_setzero_si256(); }
+		static uint32N Or(uint32N a, uint32N b) { return _mm256_or_si256(a, b); }
+		static uint32N And(uint32N a, uint32N b) { return _mm256_and_si256(a, b); }
+		static uint32N Set16(int16 value) { return _mm256_set1_epi16(value); }
+		static uint32N UnpackLo8(uint32N a) { return _mm256_unpacklo_epi8(a, Zero()); }
+		static uint32N UnpackHi8(uint32N a) { return _mm256_unpackhi_epi8(a, Zero()); }
+		static uint32N Pack16(uint32N lo, uint32N hi) { return _mm256_packus_epi16(lo, hi); }
+		static uint32N Add16(uint32N a, uint32N b) { return _mm256_add_epi16(a, b); }
+		static uint32N Sub16(uint32N a, uint32N b) { return _mm256_sub_epi16(a, b); }
+		static uint32N Mul16(uint32N a, uint32N b) { return _mm256_mullo_epi16(a, b); }
+		static uint32N Shift8(uint32N a) { return _mm256_srli_epi16(a, 8); }
+		static uint32N AddSaturate8(uint32N a, uint32N b) { return _mm256_adds_epu8(a, b); }
+		// pixel마다 alpha(4번째 16bit)를 4칸에 복사
+		static uint32N BroadcastAlpha(uint32N a) { return _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(a, 0xFF), 0xFF); }
+	};
+#endif
+
+#if defined(SIMD_BUILD_SSE)
+	struct SimdSse {
+		static constexpr int32 WIDTH = 4;
+		static constexpr int32 FULL_MASK = 0xF;
+		using uint32N = __m128i;
+
+		static uint32N Load(const uint32* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+		static void Store(uint32* p, uint32N v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+		static uint32N Set1(uint32 value) { return _mm_set1_epi32(static_cast<int32>(value)); }
+		static uint32N Equal(uint32N a, uint32N b) { return _mm_cmpeq_epi32(a, b); }
+		// SSE2에는 blendv가 없으므로 and/andnot으로 섞는다.
+		static uint32N Select(uint32N mask, uint32N a, uint32N b) { return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b)); }
+		static int32 MoveMask(uint32N mask) { return _mm_movemask_ps(_mm_castsi128_ps(mask)); }
+
+		static uint32N Zero() { return _mm_setzero_si128(); }
+		static uint32N Or(uint32N a, uint32N b) { return _mm_or_si128(a, b); }
+		static uint32N And(uint32N a, uint32N b) { return _mm_and_si128(a, b); }
+		static uint32N Set16(int16 value) { return _mm_set1_epi16(value); }
+		static uint32N UnpackLo8(uint32N a) { return _mm_unpacklo_epi8(a, Zero()); }
+		static uint32N UnpackHi8(uint32N a) { return _mm_unpackhi_epi8(a, Zero()); }
+		static uint32N Pack16(uint32N lo, uint32N hi) { return _mm_packus_epi16(lo, hi); }
+		static uint32N Add16(uint32N a, uint32N b) { return _mm_add_epi16(a, b); }
+		static uint32N Sub16(uint32N a, uint32N b) { return _mm_sub_epi16(a, b); }
+		static uint32N Mul16(uint32N a, uint32N b) { return _mm_mullo_epi16(a, b); }
+		static uint32N Shift8(uint32N a) { return _mm_srli_epi16(a, 8); }
+		static uint32N AddSaturate8(uint32N a, uint32N b) { return _mm_adds_epu8(a, b); }
+		// pixel마다 alpha(4번째 16bit)를 4칸에 복사
+		static uint32N BroadcastAlpha(uint32N a) { return _mm_shufflehi_epi16(_mm_shufflelo_epi16(a, 0xFF), 0xFF); }
+	};
+#endif
+
+	// CpuFeatures::GetSimd()에 맞는 SIMD로 kernel(SimdAvx2 or SimdSse)을 실행 (scalar = 0)
+	template<typename Kernel>
+	int32 RunBatch(Kernel&& kernel) {
+		switch (CpuFeatures::GetSimd()) {
+#if defined(SIMD_BUILD_AVX2)
+		case SimdLevel::SL_Avx2: return kernel(SimdAvx2());
+#endif
+#if defined(SIMD_BUILD_SSE)
+		case SimdLevel::SL_Sse: return kernel(SimdSse());
+#endif
+		default: return 0;
+		}
+	}
+
+	// BlitUtils::Div255와 같다. (16bit, x = 0 ~ 255 * 255)
+	template<typename S, typename uint32N = typename S::uint32N>
+	inline uint32N Div255N(uint32N x) {
+		const uint32N rounded = S::Add16(x, S::Set16(128));
+		return S::Shift8(S::Add16(rounded, S::Shift8(rounded)));
+	}
+
+	// 아래 kernel들은 WIDTH개씩 처리할 수 있는 만큼 처리하고 처리한 수를 반환한다. (남은 것은 scalar)
+	template<typename S>
+	int32 ColorKeyRowN(uint32* dest, const uint32* src, int32 count, uint32 key) {
+		using uint32N = typename S::uint32N;
+		const uint32N keyN = S::Set1(key);
+
+		int32 i = 0;
+		for (; i + S::WIDTH <= count; i += S::WIDTH) {
+			const uint32N pixels = S::Load(src + i);
+			const uint32N transparent = S::Equal(pixels, keyN);
+
+			// sprite는 투명한 부분과 불투명한 부분이 길게 이어지므로 대부분 둘 중 하나
+			const int32 mask = S::MoveMask(transparent);
+			if (mask == S::FULL_MASK)
+				continue;
+			if (mask == 0) {
+				S::Store(dest + i, pixels);
+				continue;
+			}
+
+			S::Store(dest + i, S::Select(transparent, S::Load(dest + i), pixels));
+		}
+		return i;
+	}
+
+	template<typename S>
+	int32 BlendRowN(uint32* dest, const uint32* src, int32 count, uint32 opacity, uint32 alphaFill) {
+		using uint32N = typename S::uint32N;
+		const uint32N fillN = S::Set1(alphaFill);
+		const uint32N alphaMask = S::Set1(0xFF000000);
+		const uint32N zero = S::Zero();
+		const uint32N opacityN = S::Set16(static_cast<int16>(opacity));
+		const uint32N maxN = S::Set16(255);
+
+		int32 i = 0;
+		for (; i + S::WIDTH <= count; i += S::WIDTH) {
+			const uint32N pixels = S::Or(S::Load(src + i), fillN);
+			const uint32N alpha = S::And(pixels, alphaMask);
+
+			// 가장자리 외에는 대부분 모두 투명하거나 모두 불투명하다.
+			if (S::MoveMask(S::Equal(alpha, zero)) == S::FULL_MASK)
+				continue;
+			if (opacity == 255 && S::MoveMask(S::Equal(alpha, alphaMask)) == S::FULL_MASK) {
+				S::Store(dest + i, pixels);
+				continue;
+			}
+
+			// 앞/뒤 절반씩 16bit로
+			uint32N srcLo = S::UnpackLo8(pixels);
+			uint32N srcHi = S::UnpackHi8(pixels);
+			if (opacity != 255) {
+				srcLo = Div255N<S>(S::Mul16(srcLo, opacityN));
+				srcHi = Div255N<S>(S::Mul16(srcHi, opacityN));
+			}
+
+			const uint32N destN = S::Load(dest + i);
+			const uint32N destLo = Div255N<S>(S::Mul16(S::UnpackLo8(destN), S::Sub16(maxN, S::BroadcastAlpha(srcLo))));
+			const uint32N destHi = Div255N<S>(S::Mul16(S::UnpackHi8(destN), S::Sub16(maxN, S::BroadcastAlpha(srcHi))));
+
+			S::Store(dest + i, S::AddSaturate8(S::Pack16(srcLo, srcHi), S::Pack16(destLo, destHi)));
+		}
+		return i;
+	}
+
+	// row마다 isTransparent가 아닌 pixel이 이어지는 구간을 추가
+	template<typename Func>
+	void BuildSpans(ColorKeySpans& result, const uint32* pixels, int32 width, int32 height, Func isTransparent)
+	{
+		result.Clear();
+
+		// Span에 uint16으로 저장
+		if (width <= 0 || height <= 0 || width > UINT16_MAX)
+			return;
+
+		std::vector<uint32>& rowOffsets = result.rowOffsets;
+		std::vector<ColorKeySpans::Span>& spans = result.spans;
+		rowOffsets.reserve(static_cast<size_t>(height) + 1);
+		for (int32 y = 0; y < height; ++y) {
+			rowOffsets.push_back(static_cast<uint32>(spans.size()));
+
+			const uint32* row = pixels + static_cast<size_t>(y) * width;
+			int32 x = 0;
+			while (x < width) {
+				// key 건너뛰기
+				while (x < width && isTransparent(row[x]))
+					++x;
+				const int32 start = x;
+				while (x < width && isTransparent(row[x]) == false)
+					++x;
+				if (x > start)
+					spans.push_back({ static_cast<uint16>(start), static_cast<uint16>(x - start) });
+			}
+		}
+		rowOffsets.push_back(static_cast<uint32>(spans.size()));
+
+		spans.shrink_to_fit();
+	}
+
+	// 잘린 영역 [srcX, srcX + w) x [srcY, srcY + h) 안의 구간마다 func(row, from, to) (row = 0 ~ h - 1, from/to = src x)
+	template<typename Func>
+	void ForEachSpan(const ColorKeySpans& spans, int32 srcX, int32 srcY, int32 w, int32 h, Func func)
+	{
+		const int32 srcEndX = srcX + w;
+		for (int32 row = 0; row < h; ++row) {
+			const int32 srcRowIndex = srcY + row;
+
+			// 구간은 왼쪽부터 정렬되어 있으므로 srcX에 걸치는 첫 구간부터 (tile, 화면 끝에서 잘린 경우)
+			const ColorKeySpans::Span* span = spans.spans.data() + spans.rowOffsets[srcRowIndex];
+			const ColorKeySpans::Span* last = spans.spans.data() + spans.rowOffsets[srcRowIndex + 1];
+			if (srcX > 0) {
+				span = std::partition_point(span, last, [srcX](const ColorKeySpans::Span& s) {
+					return s.start + s.length <= srcX;
+				});
+			}
+
+			for (; span != last && span->start < srcEndX; ++span) {
+				const int32 from = max(static_cast<int32>(span->start), srcX);
+				const int32 to = min(span->start + span->length, srcEndX);
+				func(row, from, to);
+			}
+		}
+	}
+}
+
+void ColorKeySpans::Build(const uint32* pixels, int32 width, int32 height, uint32 key)
+{
+	BuildSpans(*this, pixels, width, height, [key](uint32 pixel) { return pixel == key; });
+}
+
+void ColorKeySpans::BuildAlpha(const uint32* pixels, int32 width, int32 height)
+{
+	BuildSpans(*this, pixels, width, height, [](uint32 pixel) { return (pixel >> 24) == 0; });
+}
+
+void ColorKeySpans::Clear()
+{
+	rowOffsets.clear();
+	spans.clear();
+}
+
+int64 ColorKeySpans::GetOpaqueCount() const
+{
+	int64 count = 0;
+	for (const Span& span : spans)
+		count += span.length;
+	return count;
+}
+
+void BlitUtils::Blit(uint32* dest, int32 destWidth, int32 destHeight, int32 x, int32 y,
+	const uint32* src, int32 srcWidth, int32 srcHeight, int32 srcX, int32 srcY, int32 w, int32 h)
+{
+	if (Clip(destWidth, destHeight, x, y, srcWidth, srcHeight, srcX, srcY, w, h) == false)
+		return;
+
+	for (int32 row = 0; row < h; ++row) {
+		const uint32* srcRow = src + static_cast<size_t>(srcY + row) * srcWidth + srcX;
+		uint32* destRow = dest + static_cast<size_t>(y + row) * destWidth + x;
+		::memcpy(destRow, srcRow, w * sizeof(uint32));
+	}
+}
+
+void BlitUtils::BlitColorKey(uint32* dest, int32 destWidth, int32 destHeight, int32 x, int32 y,
+	const uint32* src, int32 srcWidth, int32 srcHeight, int32 srcX, int32 srcY, int32 w, int32 h, uint32 key)
+{
+	if (Clip(destWidth, destHeight, x, y, srcWidth, srcHeight, srcX, srcY, w, h) == false)
+		return;
+
+	for (int32 row = 0; row < h; ++row) {
+		const uint32* srcRow = src + static_cast<size_t>(srcY + row) * srcWidth + srcX;
+		uint32* destRow = dest + static_cast<size_t>(y + row) * destWidth + x;
+		ColorKeyRow(destRow, srcRow, w, key);
+	}
+}
+
+void BlitUtils::BlitSpans(uint32* dest, int32 destWidth, int32 destHeight, int32 x, int32 y,
+	const uint32* src, int32 srcWidth, int32 srcHeight, int32 srcX, int32 srcY, int32 w, int32 h, const ColorKeySpans& spans)
+{
+	if (Clip(destWidth, destHeight, x, y, srcWidth, srcHeight, srcX, srcY, w, h) == false)
+		return;
+
+	// 잘린 영역 안의 구간만 복사
+	ForEachSpan(spans, srcX, srcY, w, h, [&](int32 row, int32 from, int32 to) {
+		const uint32* srcRow = src + static_cast<size_t>(srcY + row) * srcWidth;
+		uint32* destRow = dest + static_cast<size_t>(y + row) * destWidth + x;
+		::memcpy(destRow + (from - srcX), srcRow + from, (to - from) * sizeof(uint32));
+	});
+}
+
+void BlitUtils::BlitBlend(uint32* dest, int32 destWidth, int32 destHeight, int32 x, int32 y,
+	const uint32* src, int32 srcWidth, int32 srcHeight, int32 srcX, int32 srcY, int32 w, int32 h,
+	const ColorKeySpans& spans, uint32 opacity, uint32 alphaFill)
+{
+	if (opacity == 0 || Clip(destWidth, destHeight, x, y, srcWidth, srcHeight, srcX, srcY, w, h) == false)
+		return;
+
+	if (spans.IsEmpty()) {
+		for (int32 row = 0; row < h; ++row) {
+			const uint32* srcRow = src + static_cast<size_t>(srcY + row) * srcWidth + srcX;
+			uint32* destRow = dest + static_cast<size_t>(y + row) * destWidth + x;
+			BlendRow(destRow, srcRow, w, opacity, alphaFill);
+		}
+		return;
+	}
+
+	// 투명한(alpha 0, key) 부분은 건너뛴다.
+	ForEachSpan(spans, srcX, srcY, w, h, [&](int32 row, int32 from, int32 to) {
+		const uint32* srcRow = src + static_cast<size_t>(srcY + row) * srcWidth;
+		uint32* destRow = dest + static_cast<size_t>(y + row) * destWidth + x;
+		BlendRow(destRow + (from - srcX), srcRow + from, to - from, opacity, alphaFill);
+	});
+}
+
+bool BlitUtils::Clip(int32 destWidth, int32 destHeight, int32& x, int32& y,
+	int32 srcWidth, int32 srcHeight, int32& srcX, int32& srcY, int32& w, int32& h)
+{
+	// src 밖
+	if (srcX < 0) {
+		x -= srcX;
+		w += srcX;
+		srcX = 0;
+	}
+	if (srcY < 0) {
+		y -= srcY;
+		h += srcY;
+		srcY = 0;
+	}
+	w = min(w, srcWidth - srcX);
+	h = min(h, srcHeight - srcY);
+
+	// dest 밖
+	if (x < 0) {
+		srcX -= x;
+		w += x;
+		x = 0;
+	}
+	if (y < 0) {
+		srcY -= y;
+		h += y;
+		y = 0;
+	}
+	w = min(w, destWidth - x);
+	h = min(h, destHeight - y);
+
+	return w > 0 && h > 0;
+}
+
+void BlitUtils::ColorKeyRow(uint32* dest, const uint32* src, int32 count, uint32 key)
+{
+	const int32 i = RunBatch([&](auto simd) { return ColorKeyRowN<decltype(simd)>(dest, src, count, key); });
+	ColorKeyRowScalar(dest + i, src + i, count - i, key);
+}
+
+void BlitUtils::ColorKeyRowScalar(uint32* dest, const uint32* src, int32 count, uint32 key)
+{
+	for (int32 i = 0; i < count; ++i) {
+		if (src[i] != key)
+			dest[i] = src[i];
+	}
+}
+
+void BlitUtils::BlendRow(uint32* dest, const uint32* src, int32 count, uint32 opacity, uint32 alphaFill)
+{
+	const int32 i = RunBatch([&](auto simd) { return BlendRowN<decltype(simd)>(dest, src, count, opacity, alphaFill); });
+	BlendRowScalar(dest + i, src + i, count - i, opacity, alphaFill);
+}
+
+void BlitUtils::BlendRowScalar(uint32* dest, const uint32* src, int32 count, uint32 opacity, uint32 alphaFill)
+{
+	for (int32 i = 0; i < count; ++i) {
+		const uint32 pixel = src[i] | alphaFill;
+		const uint32 alpha = pixel >> 24;
+		if (alpha == 0)
+			continue;
+		if (alpha == 255 && opacity == 255) {
+			dest[i] = pixel;
+			continue;
+		}
+
+		const uint32 inverse = 255 - Div255(alpha * opacity);
+		uint32 result = 0;
+		for (int32 shift = 0; shift < 32; shift += 8) {
+			const uint32 s = Div255(((pixel >> shift) & 0xFF) * opacity);
+			const uint32 d = Div255(((dest[i] >> shift) & 0xFF) * inverse);
+			result |= min(s + d, 255u) << shift;
+		}
+		dest[i] = result;
+	}
+}
+
+uint32 BlitUtils::Premultiply(uint32 pixel)
+{
+	const uint32 alpha = pixel >> 24;
+	const uint32 r = Div255(((pixel >> 16) & 0xFF) * alpha);
+	const uint32 g = Div255(((pixel >> 8) & 0xFF) * alpha);
+	const uint32 b = Div255((pixel & 0xFF) * alpha);
+	return (alpha << 24) | (r << 16) | (g << 8) | b;
+}
+
+int32 BlitUtils::GetBatchWidth()
+{
+	return CpuFeatures::GetSimdWidth(CpuFeatures::GetSimd());
+}
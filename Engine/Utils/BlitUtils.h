@@ -0,0 +1,90 @@
+#pragma once
+
+/*
+	color key가 아닌 pixel이 이어지는 구간 (RLE)
+		- 줄마다 왼쪽부터 (start, length), y줄의 구간 = spans[rowOffsets[y] ~ rowOffsets[y + 1])
+		- 그릴 때 key를 비교하지 않고 구간만 memcpy 한다.
+*/
+struct ColorKeySpans
+{
+	struct Span {
+		uint16 start;
+		uint16 length;
+	};
+
+	std::vector<uint32> rowOffsets;
+	std::vector<Span> spans;
+
+	void Build(const uint32* pixels, int32 width, int32 height, uint32 key);
+	// premultiplied pixel (0xAARRGGBB)에서 alpha가 0이 아닌 구간
+	void BuildAlpha(const uint32* pixels, int32 width, int32 height);
+	void Clear();
+
+	bool IsEmpty() const { return rowOffsets.empty(); }
+	// 구간 정보의 크기 (byte)
+	size_t GetMemorySize() const { return rowOffsets.size() * sizeof(uint32) + spans.size() * sizeof(Span); }
+	// key가 아닌 pixel 수
+	int64 GetOpaqueCount() const;
+};
+
+/*
+	32bit pixel (0x00RRGGBB) 버퍼끼리 복사
+		- width = 한 줄의 pixel 수 (줄 사이에 여백은 없다)
+		- 복사할 영역은 dest와 src 밖으로 나가는 부분을 잘라낸다.
+*/
+struct BlitUtils
+{
+	// RGB() (0x00BBGGRR) -> pixel (0x00RRGGBB)
+	static uint32 ToPixel(uint32 color) {
+		return ((color & 0xFF) << 16) | (color & 0xFF00) | ((color >> 16) & 0xFF);
+	}
+
+	// (srcX, srcY)부터 w x h 만큼을 dest의 (x, y)로 복사
+	static void Blit(uint32* dest, int32 destWidth, int32 destHeight, int32 x, int32 y,
+		const uint32* src, int32 srcWidth, int32 srcHeight, int32 srcX, int32 srcY, int32 w, int32 h);
+	// Blit과 같지만 key 색인 pixel은 복사하지 않는다.
+	static void BlitColorKey(uint32* dest, int32 destWidth, int32 destHeight, int32 x, int32 y,
+		const uint32* src, int32 srcWidth, int32 srcHeight, int32 srcX, int32 srcY, int32 w, int32 h, uint32 key);
+	// BlitColorKey와 결과는 같지만 미리 구한 구간만 복사 (spans는 src로 만든 것)
+	static void BlitSpans(uint32* dest, int32 destWidth, int32 destHeight, int32 x, int32 y,
+		const uint32* src, int32 srcWidth, int32 srcHeight, int32 srcX, int32 srcY, int32 w, int32 h, const ColorKeySpans& spans);
+	/*
+		premultiplied src를 opacity(0 ~ 255)만큼 dest 위에 섞는다. (BlendRow)
+			- spans가 있으면 그 구간만 섞는다. (없으면 영역 전체)
+			- alphaFill은 src pixel에 OR 한다. (alpha가 없는 0x00RRGGBB src = 0xFF000000으로 불투명하게)
+	*/
+	static void BlitBlend(uint32* dest, int32 destWidth, int32 destHeight, int32 x, int32 y,
+		const uint32* src, int32 srcWidth, int32 srcHeight, int32 srcX, int32 srcY, int32 w, int32 h,
+		const ColorKeySpans& spans, uint32 opacity, uint32 alphaFill);
+
+	// 영역을 dest와 src 안으로 자른다. (잘린 만큼 시작점도 옮긴다, 그릴 부분이 없으면 false)
+	static bool Clip(int32 destWidth, int32 destHeight, int32& x, int32& y,
+		int32 srcWidth, int32 srcHeight, int32& srcX, int32& srcY, int32& w, int32& h);
+
+public:
+	/*
+		한 줄 color-key 복사
+			- AVX2 = 8개, SSE2 = 4개씩 (CpuFeatures::GetSimd()) key와 비교해서 key가 아닌 pixel만 덮어쓴다. (남은 것은 scalar)
+			- 모두 key면 건너뛰고, key가 없으면 그대로 저장한다.
+	*/
+	static void ColorKeyRow(uint32* dest, const uint32* src, int32 count, uint32 key);
+	static void ColorKeyRowScalar(uint32* dest, const uint32* src, int32 count, uint32 key);
+
+	/*
+		한 줄 alpha blend (premultiplied, 채널마다 0 ~ 255)
+			- s = src * opacity / 255, dest = s + dest * (255 - s.alpha) / 255 (반올림, scalar와 결과가 같다)
+			- AVX2 = 8개, SSE2 = 4개씩 16bit로 늘려서 곱한다. (남은 것은 scalar)
+			- 모두 alpha 0이면 건너뛰고, opacity 255에 모두 alpha 255면 그대로 저장한다.
+	*/
+	static void BlendRow(uint32* dest, const uint32* src, int32 count, uint32 opacity, uint32 alphaFill);
+	static void BlendRowScalar(uint32* dest, const uint32* src, int32 count, uint32 opacity, uint32 alphaFill);
+
+	// RGB에 alpha를 곱한다. (0xAARRGGBB)
+	static uint32 Premultiply(uint32 pixel);
+	// x / 255 반올림 (x = 0 ~ 255 * 255)
+	static uint32 Div255(uint32 x) { return (x + 128 + ((x + 128) >> 8)) >> 8; }
+
+	// 지금 사용되는 batch 크기 (1 = scalar, CpuFeatures::GetSimd())
+	static int32 GetBatchWidth();
+};
+
@@ -0,0 +1,648 @@
+#include "pch.h"
+#include "CollisionBenchmark.h"
+#include "CollisionUtils.h"
+#include "CpuFeatures.h"
+#include "RenderBenchmark.h"
+#include "Collision\ColliderArrays.h"
+#include "Component\SquareComponent.h"
+#include "Component\CircleComponent.h"
+#include "Manager\CollisionManager.h"
+#include "Manager\ThreadManager.h"
+#include <random>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
+namespace {
+	// 기존 Collider::CheckCollision* 와 같은 방식 (비교용)
+	RECT ToLegacyRect(const ColliderArrays& arrays, int32 row)
+	{
+		return { static_cast<int32>(arrays.minX[row]), static_cast<int32>(arrays.minY[row]),
+			static_cast<int32>(arrays.maxX[row]), static_cast<int32>(arrays.maxY[row]) };
+	}
+
+	bool LegacyBoxToBox(const ColliderArrays& arrays, int32 a, int32 b)
+	{
+		const RECT r1 = ToLegacyRect(arrays, a);
+		const RECT r2 = ToLegacyRect(arrays, b);
+		RECT intersect = {};
+		return ::IntersectRect(&intersect, &r1, &r2);
+	}
+
+	bool LegacyPointInCircle(float cx, float cy, float radius, float x, float y)
+	{
+		const float dx = cx - x;
+		const float dy = cy - y;
+		return dx * dx + dy * dy <= radius * radius;
+	}
+
+	bool LegacyCircleToBox(const ColliderArrays& arrays, int32 circle, int32 square)
+	{
+		const RECT org = ToLegacyRect(arrays, square);
+		const float cx = arrays.centerX[circle];
+		const float cy = arrays.centerY[circle];
+		const float radius = arrays.radius[circle];
+
+		const bool horizon = org.left <= cx && cx <= org.right;
+		const bool verticle = org.top <= cy && cy <= org.bottom;
+		if (horizon || verticle) {
+			const RECT exRect = {
+				org.left - static_cast<LONG>(radius),
+				org.top - static_cast<LONG>(radius),
+				org.right + static_cast<LONG>(radius),
+				org.bottom + static_cast<LONG>(radius),
+			};
+			return exRect.left < cx && cx < exRect.right && exRect.top < cy && cy < exRect.bottom;
+		}
+
+		return LegacyPointInCircle(cx, cy, radius, static_cast<float>(org.left), static_cast<float>(org.top))
+			|| LegacyPointInCircle(cx, cy, radius, static_cast<float>(org.left), static_cast<float>(org.bottom))
+			|| LegacyPointInCircle(cx, cy, radius, static_cast<float>(org.right), static_cast<float>(org.bottom))
+			|| LegacyPointInCircle(cx, cy, radius, static_cast<float>(org.right), static_cast<float>(org.top));
+	}
+
+	bool LegacyCircleToCircle(const ColliderArrays& arrays, int32 a, int32 b)
+	{
+		const float dx = arrays.centerX[a] - arrays.centerX[b];
+		const float dy = arrays.centerY[a] - arrays.centerY[b];
+		return std::sqrt(dx * dx + dy * dy) <= arrays.radius[a] + arrays.radius[b];
+	}
+
+	bool LegacyTestOverlap(const ColliderArrays& arrays, int32 a, int32 b)
+	{
+		const bool squareA = arrays.types[a] == ColliderType::CT_Square;
+		const bool squareB = arrays.types[b] == ColliderType::CT_Square;
+
+		if (squareA && squareB)
+			return LegacyBoxToBox(arrays, a, b);
+		if (squareA == false && squareB == false)
+			return LegacyCircleToCircle(arrays, a, b);
+		return squareA ? LegacyCircleToBox(arrays, b, a) : LegacyCircleToBox(arrays, a, b);
+	}
+
+	// func를 iterations번 실행하고 pair 하나당 걸린 시간(ns)
+	template<typename Func>
+	double MeasureNsPerPair(int32 iterations, int64 pairCount, Func&& func)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		for (int32 i = 0; i < iterations; ++i)
+			func();
+		const auto end = std::chrono::steady_clock::now();
+
+		const double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+		return ns / static_cast<double>(pairCount * iterations);
+	}
+
+	// 명령줄에서 "key=value"의 value (없으면 빈 문자열)
+	std::wstring FindOption(const std::vector<std::wstring>& args, const std::wstring& key)
+	{
+		const std::wstring token = key + L"=";
+
+		// 단어 전체의 앞부분만 (ex: "count="를 찾을때 "xcount=" 제외)
+		for (const std::wstring& arg : args) {
+			if (arg.compare(0, token.size(), token) == 0)
+				return arg.substr(token.size());
+		}
+
+		return {};
+	}
+
+	// 옵션이 하나라도 있었는지 반환
+	bool ParseScenario(const std::vector<std::wstring>& args, CollisionScenario& scenario)
+	{
+		bool parsed = false;
+		auto read = [&](const wchar_t* key, auto&& apply) {
+			const std::wstring value = FindOption(args, key);
+			if (value.empty())
+				return;
+			apply(value);
+			parsed = true;
+		};
+
+		read(L"name", [&](const std::wstring& value) { scenario.name = value; });
+		read(L"count", [&](const std::wstring& value) { scenario.colliderCount = max(2, std::stoi(value)); });
+		read(L"frames", [&](const std::wstring& value) { scenario.frames = max(1, std::stoi(value)); });
+		read(L"world", [&](const std::wstring& value) { scenario.worldSize = std::stof(value); });
+		read(L"minsize", [&](const std::wstring& value) { scenario.minSize = std::stof(value); });
+		read(L"maxsize", [&](const std::wstring& value) { scenario.maxSize = std::stof(value); });
+		read(L"speed", [&](const std::wstring& value) { scenario.speed = std::stof(value); });
+		read(L"circle", [&](const std::wstring& value) { scenario.circleRatio = std::stof(value); });
+		read(L"static", [&](const std::wstring& value) { scenario.staticRatio = std::stof(value); });
+		read(L"seed", [&](const std::wstring& value) { scenario.seed = static_cast<uint32>(std::stoul(value)); });
+		read(L"layers", [&](const std::wstring& value) { scenario.mixedLayers = value != L"single"; });
+		read(L"dist", [&](const std::wstring& value) {
+			if (value == L"cluster")
+				scenario.distribution = ScenarioDistribution::SD_Cluster;
+			else if (value == L"grid")
+				scenario.distribution = ScenarioDistribution::SD_Grid;
+			else
+				scenario.distribution = ScenarioDistribution::SD_Uniform;
+		});
+		read(L"bp", [&](const std::wstring& value) {
+			scenario.broadphase = value == L"sap" ? BroadphaseType::BP_SweepAndPrune : BroadphaseType::BP_SpatialHash;
+		});
+
+		scenario.maxSize = max(scenario.minSize, scenario.maxSize);
+		return parsed;
+	}
+
+	const wchar_t* ToString(ScenarioDistribution distribution)
+	{
+		switch (distribution) {
+		case ScenarioDistribution::SD_Cluster: return L"cluster";
+		case ScenarioDistribution::SD_Grid: return L"grid";
+		default: return L"uniform";
+		}
+	}
+
+	const wchar_t* ToString(BroadphaseType broadphase)
+	{
+		return broadphase == BroadphaseType::BP_SweepAndPrune ? L"sap" : L"hash";
+	}
+}
+
+std::vector<std::wstring> CollisionBenchmark::SplitArgs(const std::wstring& commandLine)
+{
+	std::vector<std::wstring> args;
+	std::wistringstream stream(commandLine);
+	for (std::wstring arg; stream >> arg; )
+		args.push_back(std::move(arg));
+	return args;
+}
+
+bool CollisionBenchmark::HasArg(const std::vector<std::wstring>& args, const wchar_t* name)
+{
+	return std::find(args.begin(), args.end(), name) != args.end();
+}
+
+int32 CollisionBenchmark::Run(const std::wstring& commandLine)
+{
+	return Run(SplitArgs(commandLine));
+}
+
+int32 CollisionBenchmark::Run(const std::vector<std::wstring>& args)
+{
+	// 단어 단위로 정확히 비교한다. (ex: "name=render_test"는 render가 아니다)
+	std::wstring report;
+	std::wstring csv;
+
+	// 게임과 같은 thread 수로 측정 (World::Init과 같다)
+	GET_SINGLE(ThreadManager)->Init();
+
+	if (HasArg(args, L"narrowphase"))
+		report += RunNarrowphase();
+	if (HasArg(args, L"threads"))
+		report += RunThreadScaling();
+	if (HasArg(args, L"scenario"))
+		csv = RunScenarios(args);
+	report += RenderBenchmark::Run(args);
+
+	if (report.empty() && csv.empty()) {
+		report = L"usage: -benchmark narrowphase threads scenario " + std::wstring(RenderBenchmark::GetModes()) + L"\n"
+			L"  scenario options: count=N frames=N dist=uniform|cluster|grid bp=hash|sap speed=F static=F circle=F\n"
+			L"                    world=F minsize=F maxsize=F layers=mixed|single seed=N name=S\n";
+	}
+
+	// scenario만 실행하면 표준 출력은 CSV만 남는다.
+	GET_SINGLE(ThreadManager)->Clear();
+
+	const std::wstring output = report + csv;
+	::OutputDebugStringW(output.c_str());
+	std::wcout << output;
+
+	if (report.empty() == false) {
+		std::wofstream file(fs::path(L"Benchmark.txt"));
+		if (file.is_open() == false)
+			return -1;
+		file << report;
+	}
+
+	if (csv.empty() == false) {
+		std::wofstream file(fs::path(L"Benchmark.csv"));
+		if (file.is_open() == false)
+			return -1;
+		file << csv;
+	}
+
+	return 0;
+}
+
+std::wstring CollisionBenchmark::RunNarrowphase(int32 colliderCount, int32 candidateCount, int32 iterations)
+{
+	std::mt19937 rng(1234);
+	std::uniform_real_distribution<float> posDist(0.f, 2000.f);
+	std::uniform_real_distribution<float> sizeDist(8.f, 96.f);
+
+	// 앞쪽 절반은 Square, 뒤쪽 절반은 Circle
+	std::vector<std::shared_ptr<Collider>> colliders;
+	const int32 squareCount = colliderCount / 2;
+	for (int32 i = 0; i < colliderCount; ++i) {
+		std::shared_ptr<Collider> collider;
+		if (i < squareCount) {
+			std::shared_ptr<SquareComponent> square = std::make_shared<SquareComponent>();
+			square->SetSize({ sizeDist(rng), sizeDist(rng) });
+			collider = square;
+		}
+		else {
+			std::shared_ptr<CircleComponent> circle = std::make_shared<CircleComponent>();
+			circle->SetRadius(sizeDist(rng) * 0.5f);
+			collider = circle;
+		}
+		collider->AddLocalPos({ posDist(rng), posDist(rng) });
+		colliders.push_back(collider);
+	}
+
+	ColliderArrays arrays;
+	arrays.Build(colliders);
+
+	// Collider마다 Square 후보, Circle 후보를 candidateCount개씩
+	std::uniform_int_distribution<int32> squareDist(0, squareCount - 1);
+	std::uniform_int_distribution<int32> circleDist(squareCount, colliderCount - 1);
+	std::vector<int32> squareCandidates(static_cast<size_t>(colliderCount) * candidateCount);
+	std::vector<int32> circleCandidates(static_cast<size_t>(colliderCount) * candidateCount);
+	for (int32 i = 0; i < squareCandidates.size(); ++i) {
+		squareCandidates[i] = squareDist(rng);
+		circleCandidates[i] = circleDist(rng);
+	}
+
+	const int64 pairCount = static_cast<int64>(colliderCount) * candidateCount * 2;
+	std::vector<uint8> legacyResults(pairCount), scalarResults(pairCount), batchResults(pairCount);
+
+	auto forEachPair = [&](auto&& test, std::vector<uint8>& results) {
+		int64 k = 0;
+		for (int32 a = 0; a < colliderCount; ++a) {
+			const int32* squares = &squareCandidates[static_cast<size_t>(a) * candidateCount];
+			const int32* circles = &circleCandidates[static_cast<size_t>(a) * candidateCount];
+			for (int32 i = 0; i < candidateCount; ++i)
+				results[k++] = test(a, squares[i]);
+			for (int32 i = 0; i < candidateCount; ++i)
+				results[k++] = test(a, circles[i]);
+		}
+	};
+
+	const double componentNs = MeasureNsPerPair(iterations, pairCount, [&]() {
+		forEachPair([&](int32 a, int32 b) { return colliders[a]->CheckCollision(colliders[b]); }, legacyResults);
+	});
+
+	const double legacyNs = MeasureNsPerPair(iterations, pairCount, [&]() {
+		forEachPair([&](int32 a, int32 b) { return LegacyTestOverlap(arrays, a, b); }, legacyResults);
+	});
+
+	const double scalarNs = MeasureNsPerPair(iterations, pairCount, [&]() {
+		forEachPair([&](int32 a, int32 b) { return CollisionUtils::TestOverlap(arrays, a, b); }, scalarResults);
+	});
+
+	auto runBatch = [&]() {
+		uint8* results = batchResults.data();
+		for (int32 a = 0; a < colliderCount; ++a) {
+			const int32* squares = &squareCandidates[static_cast<size_t>(a) * candidateCount];
+			const int32* circles = &circleCandidates[static_cast<size_t>(a) * candidateCount];
+			if (a < squareCount) {
+				CollisionUtils::BoxVsBoxes(arrays, a, squares, candidateCount, results);
+				CollisionUtils::BoxVsCircles(arrays, a, circles, candidateCount, results + candidateCount);
+			}
+			else {
+				CollisionUtils::CircleVsBoxes(arrays, a, squares, candidateCount, results);
+				CollisionUtils::CircleVsCircles(arrays, a, circles, candidateCount, results + candidateCount);
+			}
+			results += candidateCount * 2;
+		}
+	};
+
+	int64 legacyMismatch = 0;
+	int64 hits = 0;
+	for (int64 i = 0; i < pairCount; ++i) {
+		legacyMismatch += scalarResults[i] != legacyResults[i];
+		hits += scalarResults[i];
+	}
+
+	std::wstring report = std::format(L"[Narrowphase] colliders: {}, pairs: {}, iterations: {}, hits: {}\n",
+		colliderCount, pairCount, iterations, hits);
+	report += std::format(L"  Component CheckCollision : {:.2f} ns/pair\n", componentNs);
+	report += std::format(L"  Legacy (RECT, sqrt)      : {:.2f} ns/pair\n", legacyNs);
+	report += std::format(L"  Scalar                   : {:.2f} ns/pair\n", scalarNs);
+
+	// CPU가 지원하는 SIMD를 하나씩 골라서 측정 (결과는 scalar와 같아야 한다)
+	const SimdLevel prevSimd = CpuFeatures::GetSimd();
+	const SimdLevel supported = CpuFeatures::GetSupportedSimd();
+	std::wstring mismatches;
+	for (SimdLevel level : { SimdLevel::SL_Sse, SimdLevel::SL_Avx2 }) {
+		if (level > supported)
+			break;
+
+		CpuFeatures::SetSimd(level);
+		std::fill(batchResults.begin(), batchResults.end(), static_cast<uint8>(2));
+		const double batchNs = MeasureNsPerPair(iterations, pairCount, runBatch);
+
+		int64 batchMismatch = 0;
+		for (int64 i = 0; i < pairCount; ++i)
+			batchMismatch += scalarResults[i] != batchResults[i];
+
+		report += std::format(L"  {:<4} batch (width {})     : {:.2f} ns/pair\n", CpuFeatures::GetSimdName(level), CollisionUtils::GetBatchWidth(), batchNs);
+		mismatches += std::format(L"{} != Scalar: {}, ", CpuFeatures::GetSimdName(level), batchMismatch);
+	}
+	CpuFeatures::SetSimd(prevSimd);
+
+	// legacy는 RECT 정수 변환 때문에 경계에서 조금 다르다.
+	report += std::format(L"  {}Legacy != Scalar: {}\n", mismatches, legacyMismatch);
+
+	return report;
+}
+
+std::wstring CollisionBenchmark::RunThreadScaling(int32 colliderCount, int32 ticks)
+{
+	std::mt19937 rng(1234);
+	std::uniform_real_distribution<float> posDist(0.f, 2000.f);
+	std::uniform_real_distribution<float> sizeDist(8.f, 48.f);
+
+	// 서로 많이 겹치도록 좁은 곳에 모아둔다.
+	std::vector<std::shared_ptr<Collider>> colliders;
+	for (int32 i = 0; i < colliderCount; ++i) {
+		std::shared_ptr<Collider> collider;
+		if (i % 2 == 0) {
+			std::shared_ptr<SquareComponent> square = std::make_shared<SquareComponent>();
+			square->SetSize({ sizeDist(rng), sizeDist(rng) });
+			collider = square;
+		}
+		else {
+			std::shared_ptr<CircleComponent> circle = std::make_shared<CircleComponent>();
+			circle->SetRadius(sizeDist(rng) * 0.5f);
+			collider = circle;
+		}
+		collider->AddLocalPos({ posDist(rng), posDist(rng) });
+		colliders.push_back(collider);
+	}
+
+	GET_SINGLE(CollisionManager)->Init();
+	for (std::shared_ptr<Collider>& collider : colliders)
+		GET_SINGLE(CollisionManager)->AddCollider(collider);
+
+	const int32 maxThreadCount = max(1, static_cast<int32>(std::thread::hardware_concurrency()));
+	std::vector<int32> threadCounts;
+	for (int32 count = 1; count < maxThreadCount; count *= 2)
+		threadCounts.push_back(count);
+	threadCounts.push_back(maxThreadCount);
+
+	std::wstring report = std::format(L"[Thread Scaling] colliders: {}, ticks: {}\n", colliderCount, ticks);
+
+	// Collider가 움직이지 않으므로 SLEEP_TICKS가 지나면 모두 잠들어 검사할 pair가 없어진다.
+	// 매 Tick 전에 깨워서 (측정에서 제외) 모든 thread 수가 같은 일을 하도록 한다.
+	auto wakeAll = [&]() {
+		for (std::shared_ptr<Collider>& collider : colliders)
+			collider->Wake(false);
+	};
+
+	double baseMs = 0.0;
+	int32 basePairs = -1;
+	bool samePairs = true;
+	for (int32 threadCount : threadCounts) {
+		GET_SINGLE(ThreadManager)->Init(threadCount);
+
+		// 첫 Tick은 cache 준비, worker 시작 비용이 섞이므로 제외
+		wakeAll();
+		GET_SINGLE(CollisionManager)->Tick();
+
+		double totalMs = 0.0;
+		for (int32 i = 0; i < ticks; ++i) {
+			wakeAll();
+			const auto start = std::chrono::steady_clock::now();
+			GET_SINGLE(CollisionManager)->Tick();
+			const auto end = std::chrono::steady_clock::now();
+			totalMs += std::chrono::duration<double, std::milli>(end - start).count();
+		}
+
+		const double ms = totalMs / ticks;
+		if (baseMs == 0.0)
+			baseMs = ms;
+
+		// thread 수와 관계없이 검사한 pair 수는 같아야 한다. (다르면 다른 일을 측정한 것)
+		const CollisionStats& stats = GET_SINGLE(CollisionManager)->GetStats();
+		if (basePairs < 0)
+			basePairs = stats.pairsTested;
+		const bool same = stats.pairsTested == basePairs;
+		samePairs &= same;
+		assert(same);
+
+		report += std::format(L"  threads {} : {:.3f} ms/tick, x{:.2f} (pairs: {}{}, hits: {}, resting: {}, tasks: {})\n",
+			threadCount, ms, baseMs / ms, stats.pairsTested, same ? L"" : L" != 1 thread", stats.pairsHit, stats.resting, stats.tasks);
+	}
+	if (samePairs == false)
+		report += L"  WARNING: pairs tested differ between thread counts, speedup is not comparable\n";
+
+	for (std::shared_ptr<Collider>& collider : colliders)
+		GET_SINGLE(CollisionManager)->RemoveCollider(collider);
+	GET_SINGLE(ThreadManager)->Init();
+
+	return report;
+}
+
+CollisionScenarioResult CollisionBenchmark::RunScenario(const CollisionScenario& scenario)
+{
+	std::mt19937 rng(scenario.seed);
+	std::uniform_real_distribution<float> unitDist(0.f, 1.f);
+	std::uniform_real_distribution<float> posDist(0.f, scenario.worldSize);
+	std::uniform_real_distribution<float> sizeDist(scenario.minSize, scenario.maxSize);
+	std::uniform_real_distribution<float> angleDist(0.f, MathUtils::TwoPI);
+
+	// Cluster : 500개 마다 한 덩어리
+	std::vector<Vector2D> clusterCenters(max(1, scenario.colliderCount / 500));
+	for (Vector2D& center : clusterCenters)
+		center = Vector2D(posDist(rng), posDist(rng));
+	std::normal_distribution<float> clusterDist(0.f, scenario.worldSize * 0.03f);
+	std::uniform_int_distribution<int32> clusterIndexDist(0, static_cast<int32>(clusterCenters.size()) - 1);
+
+	// Grid : 정사각형 모양으로 빈틈없이
+	const int32 gridWidth = max(1, static_cast<int32>(std::ceil(std::sqrt(static_cast<float>(scenario.colliderCount)))));
+	const float gridSpacing = scenario.worldSize / gridWidth;
+
+	std::vector<std::shared_ptr<Collider>> colliders;
+	std::vector<Vector2D> positions;
+	std::vector<Vector2D> velocities;
+	for (int32 i = 0; i < scenario.colliderCount; ++i) {
+		std::shared_ptr<Collider> collider;
+		if (unitDist(rng) < scenario.circleRatio) {
+			std::shared_ptr<CircleComponent> circle = std::make_shared<CircleComponent>();
+			circle->SetRadius(sizeDist(rng) * 0.5f);
+			collider = circle;
+		}
+		else {
+			std::shared_ptr<SquareComponent> square = std::make_shared<SquareComponent>();
+			square->SetSize({ sizeDist(rng), sizeDist(rng) });
+			collider = square;
+		}
+
+		Vector2D pos;
+		switch (scenario.distribution) {
+		case ScenarioDistribution::SD_Cluster: {
+			const Vector2D& center = clusterCenters[clusterIndexDist(rng)];
+			pos = Vector2D(center.X + clusterDist(rng), center.Y + clusterDist(rng));
+			break;
+		}
+		case ScenarioDistribution::SD_Grid:
+			pos = Vector2D((i % gridWidth + 0.5f) * gridSpacing, (i / gridWidth + 0.5f) * gridSpacing);
+			break;
+		default:
+			pos = Vector2D(posDist(rng), posDist(rng));
+			break;
+		}
+
+		Vector2D velocity = Vector2D::Zero;
+		if (unitDist(rng) < scenario.staticRatio) {
+			collider->SetStatic(true);
+		}
+		else {
+			const float angle = angleDist(rng);
+			const float speed = scenario.speed * unitDist(rng);
+			velocity = Vector2D(std::cos(angle) * speed, std::sin(angle) * speed);
+		}
+
+		// 게임과 비슷하게 Character, Object, Projectile을 섞는다.
+		if (scenario.mixedLayers) {
+			switch (i % 5) {
+			case 0:
+			case 1:
+				collider->SetCollisionLayer(CLT_Character);
+				collider->SetCollisionFlag(CLT_Object | CLT_Character);
+				break;
+			case 2:
+			case 3:
+				collider->SetCollisionLayer(CLT_Object);
+				collider->SetCollisionFlag(CLT_Character | CLT_Projectile);
+				break;
+			default:
+				collider->SetCollisionLayer(CLT_Projectile);
+				collider->SetCollisionFlag(CLT_Object | CLT_Character);
+				break;
+			}
+		}
+		else {
+			collider->SetCollisionLayer(CLT_Object);
+			collider->SetCollisionFlag(CLT_Object);
+		}
+
+		collider->AddLocalPos(pos);
+		colliders.push_back(collider);
+		positions.push_back(pos);
+		velocities.push_back(velocity);
+	}
+
+	const BroadphaseType prevBroadphase = GET_SINGLE(CollisionManager)->GetBroadphaseType();
+	GET_SINGLE(CollisionManager)->SetBroadphase(scenario.broadphase);
+	for (std::shared_ptr<Collider>& collider : colliders)
+		GET_SINGLE(CollisionManager)->AddCollider(collider);
+
+	// 첫 Tick은 처음 겹친 pair의 Begin 이벤트, cache 준비 비용이 섞이므로 제외
+	GET_SINGLE(CollisionManager)->Tick();
+
+	CollisionScenarioResult result;
+	result.minNs = DBL_MAX;
+	double totalNs = 0.0;
+	for (int32 frame = 0; frame < scenario.frames; ++frame) {
+		// 월드 밖으로 나가면 튕겨서 밀도를 유지
+		for (int32 i = 0; i < colliders.size(); ++i) {
+			Vector2D& velocity = velocities[i];
+			if (velocity == Vector2D::Zero)
+				continue;
+
+			Vector2D& pos = positions[i];
+			pos += velocity;
+			if (pos.X < 0.f || pos.X > scenario.worldSize)
+				velocity.X = -velocity.X;
+			if (pos.Y < 0.f || pos.Y > scenario.worldSize)
+				velocity.Y = -velocity.Y;
+			colliders[i]->AddLocalPos(pos);
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+		GET_SINGLE(CollisionManager)->Tick();
+		const auto end = std::chrono::steady_clock::now();
+
+		const double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+		totalNs += ns;
+		result.minNs = min(result.minNs, ns);
+		result.maxNs = max(result.maxNs, ns);
+
+		const CollisionStats& stats = GET_SINGLE(CollisionManager)->GetStats();
+		result.pairsTested += stats.pairsTested;
+		result.pairsHit += stats.pairsHit;
+		result.resting += stats.resting;
+		result.events += stats.events;
+	}
+
+	result.nsPerTick = totalNs / scenario.frames;
+	result.pairsTested /= scenario.frames;
+	result.pairsHit /= scenario.frames;
+	result.resting /= scenario.frames;
+
+	for (std::shared_ptr<Collider>& collider : colliders)
+		GET_SINGLE(CollisionManager)->RemoveCollider(collider);
+	GET_SINGLE(CollisionManager)->SetBroadphase(prevBroadphase);
+
+	return result;
+}
+
+std::wstring CollisionBenchmark::RunScenarios(const std::vector<std::wstring>& args)
+{
+	std::vector<CollisionScenario> scenarios;
+
+	CollisionScenario custom;
+	if (ParseScenario(args, custom)) {
+		scenarios.push_back(custom);
+
+		// bp를 고르지 않았으면 두 Broadphase 모두
+		if (FindOption(args, L"bp").empty()) {
+			custom.broadphase = BroadphaseType::BP_SweepAndPrune;
+			scenarios.push_back(custom);
+		}
+	}
+	else {
+		// 기본 scenario (Broadphase마다 한번씩)
+		CollisionScenario uniform;
+		uniform.name = L"uniform";
+
+		CollisionScenario cluster;
+		cluster.name = L"cluster";
+		cluster.distribution = ScenarioDistribution::SD_Cluster;
+
+		CollisionScenario grid;
+		grid.name = L"grid";
+		grid.distribution = ScenarioDistribution::SD_Grid;
+		grid.speed = 0.5f;
+
+		CollisionScenario mostlyStatic;
+		mostlyStatic.name = L"static80";
+		mostlyStatic.staticRatio = 0.8f;
+
+		CollisionScenario large;
+		large.name = L"uniform20k";
+		large.colliderCount = 20000;
+		large.worldSize = 8000.f;
+		large.frames = 30;
+
+		for (CollisionScenario scenario : { uniform, cluster, grid, mostlyStatic, large }) {
+			scenario.broadphase = BroadphaseType::BP_SpatialHash;
+			scenarios.push_back(scenario);
+			scenario.broadphase = BroadphaseType::BP_SweepAndPrune;
+			scenarios.push_back(scenario);
+		}
+	}
+
+	std::wstring csv = GetScenarioHeader();
+	for (const CollisionScenario& scenario : scenarios)
+		csv += GetScenarioRow(scenario, RunScenario(scenario));
+
+	return csv;
+}
+
+std::wstring CollisionBenchmark::GetScenarioHeader()
+{
+	return L"name,broadphase,distribution,colliders,frames,threads,speed,static_ratio,ns_per_tick,min_ns,max_ns,pairs_tested,pairs_hit,resting,events\n";
+}
+
+std::wstring CollisionBenchmark::GetScenarioRow(const CollisionScenario& scenario, const CollisionScenarioResult& result)
+{
+	return std::format(L"{},{},{},{},{},{},{:.2f},{:.2f},{:.0f},{:.0f},{:.0f},{:.1f},{:.1f},{:.1f},{}\n",
+		scenario.name, ToString(scenario.broadphase), ToString(scenario.distribution), scenario.colliderCount, scenario.frames,
+		GET_SINGLE(ThreadManager)->GetThreadCount(), scenario.speed, scenario.staticRatio,
+		result.nsPerTick, result.minNs, result.maxNs, result.pairsTested, result.pairsHit, result.resting, result.events);
+}
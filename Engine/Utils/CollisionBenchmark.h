@@ -0,0 +1,71 @@
+#pragma once
+
+// Scenario에서 Collider를 배치하는 방법
+enum class ScenarioDistribution {
+	SD_Uniform,	// 월드 전체에 고르게
+	SD_Cluster,	// 몇 군데에 몰려서 (많이 겹친다)
+	SD_Grid,	// 일정한 간격으로 (타일맵 위의 오브젝트처럼)
+};
+
+// Scenario 하나의 설정 (명령줄의 key=value로 바꿀 수 있다)
+struct CollisionScenario {
+	std::wstring name = L"custom";
+	int32 colliderCount = 5000;
+	int32 frames = 100;
+	ScenarioDistribution distribution = ScenarioDistribution::SD_Uniform;
+	BroadphaseType broadphase = BroadphaseType::BP_SpatialHash;
+	float worldSize = 4000.f;
+	float minSize = 8.f;
+	float maxSize = 64.f;
+	float speed = 2.f;			// 한 Tick에 움직이는 최대 거리
+	float circleRatio = 0.5f;	// Circle 비율 (나머지는 Square)
+	float staticRatio = 0.f;	// 움직이지 않는 Static Collider 비율
+	bool mixedLayers = true;	// false = 모두 CLT_Object
+	uint32 seed = 1234;
+};
+
+struct CollisionScenarioResult {
+	double nsPerTick = 0.0;
+	double minNs = 0.0;
+	double maxNs = 0.0;
+	double pairsTested = 0.0;	// Tick 평균
+	double pairsHit = 0.0;		// Tick 평균
+	double resting = 0.0;		// Tick 평균
+	int64 events = 0;			// 전체 합
+};
+
+/*
+	창 없이 실행하는 충돌 benchmark
+		- Benchmark.exe narrowphase threads scenario (render, blit, spans, dirty, tiles, alpha = RenderBenchmark)
+		- Client.exe -benchmark narrowphase
+		- Client.exe -benchmark scenario count=10000 frames=200 dist=cluster bp=sap
+		- 결과는 표준 출력, Debug 출력창, Benchmark.txt(scenario는 Benchmark.csv)에 남긴다.
+*/
+struct CollisionBenchmark
+{
+	// 명령줄에서 실행할 benchmark를 골라 실행 (반환값 = 프로그램 종료 코드)
+	static int32 Run(const std::wstring& commandLine);
+	static int32 Run(const std::vector<std::wstring>& args);
+
+	// 공백으로 나눈 단어들, 단어 전체가 name과 같은지
+	static std::vector<std::wstring> SplitArgs(const std::wstring& commandLine);
+	static bool HasArg(const std::vector<std::wstring>& args, const wchar_t* name);
+
+	// 기존 narrowphase (RECT 변환 + ::IntersectRect, sqrt, 꼭지점 검사)와 scalar, SIMD batch 비교
+	static std::wstring RunNarrowphase(int32 colliderCount = 4096, int32 candidateCount = 16, int32 iterations = 50);
+
+	// CollisionManager::Tick을 thread 수(1, 2, 4, ... CPU core 수)를 바꿔가며 측정
+	static std::wstring RunThreadScaling(int32 colliderCount = 10000, int32 ticks = 30);
+
+	/*
+		Collider를 배치하고 움직이면서 CollisionManager::Tick을 frames번 실행
+			- 첫 Tick은 준비 비용이 섞이므로 측정에서 뺀다.
+			- 결과는 GetScenarioHeader() 순서의 CSV 한 줄 (GetScenarioRow)
+	*/
+	static CollisionScenarioResult RunScenario(const CollisionScenario& scenario);
+	// key=value 옵션이 없으면 기본 scenario들을 모두 실행
+	static std::wstring RunScenarios(const std::vector<std::wstring>& args);
+
+	static std::wstring GetScenarioHeader();
+	static std::wstring GetScenarioRow(const CollisionScenario& scenario, const CollisionScenarioResult& result);
+};
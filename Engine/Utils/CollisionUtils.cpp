@@ -0,0 +1,446 @@
+#include "pch.h"
+#include "CollisionUtils.h"
+#include "Collision\ColliderArrays.h"
+#include "CpuFeatures.h"
+#include <immintrin.h>
+
+namespace {
+	/*
+		batch 함수에서 사용하는 SIMD 연산 (같은 kernel 코드를 AVX2 = 8개, SSE2 = 4개씩으로 빌드)
+			- 어느 쪽을 실행할지는 CpuFeatures::GetSimd()로 고른다.
+	*/
+#if defined(SIMD_BUILD_AVX2)
+	struct SimdAvx2 {
+		static constexpr int32 WIDTH = 8;
+		using floatN = __m256;
+
+		// others의 row들로 배열에서 값을 모아온다.
+		static floatN Gather(const std::vector<float>& values, const int32* rows) {
+			return _mm256_i32gather_ps(values.data(), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rows)), 4);
+		}
+		static floatN Set1(float value) { return _mm256_set1_ps(value); }
+		static floatN Add(floatN a, floatN b) { return _mm256_add_ps(a, b); }
+		static floatN Sub(floatN a, floatN b) { return _mm256_sub_ps(a, b); }
+		static floatN Mul(floatN a, floatN b) { return _mm256_mul_ps(a, b); }
+		static floatN Min(floatN a, floatN b) { return _mm256_min_ps(a, b); }
+		static floatN Max(floatN a, floatN b) { return _mm256_max_ps(a, b); }
+		static floatN And(floatN a, floatN b) { return _mm256_and_ps(a, b); }
+		static floatN Less(floatN a, floatN b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+		static floatN LessEqual(floatN a, floatN b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+		static int32 MoveMask(floatN a) { return _mm256_movemask_ps(a); }
+	};
+#endif
+
+#if defined(SIMD_BUILD_SSE)
+	struct SimdSse {
+		static constexpr int32 WIDTH = 4;
+		using floatN = __m128;
+
+		// SSE에는 gather가 없으므로 직접 모은다.
+		static floatN Gather(const std::vector<float>& values, const int32* rows) {
+			return _mm_set_ps(values[rows[3]], values[rows[2]], values[rows[1]], values[rows[0]]);
+		}
+		static floatN Set1(float value) { return _mm_set1_ps(value); }
+		static floatN Add(floatN a, floatN b) { return _mm_add_ps(a, b); }
+		static floatN Sub(floatN a, floatN b) { return _mm_sub_ps(a, b); }
+		static floatN Mul(floatN a, floatN b) { return _mm_mul_ps(a, b); }
+		static floatN Min(floatN a, floatN b) { return _mm_min_ps(a, b); }
+		static floatN Max(floatN a, floatN b) { return _mm_max_ps(a, b); }
+		static floatN And(floatN a, floatN b) { return _mm_and_ps(a, b); }
+		static floatN Less(floatN a, floatN b) { return _mm_cmplt_ps(a, b); }
+		static floatN LessEqual(floatN a, floatN b) { return _mm_cmple_ps(a, b); }
+		static int32 MoveMask(floatN a) { return _mm_movemask_ps(a); }
+	};
+#endif
+
+	// CpuFeatures::GetSimd()에 맞는 SIMD로 kernel(SimdAvx2 or SimdSse)을 실행 (scalar = 0)
+	template<typename Kernel>
+	int32 RunBatch(Kernel&& kernel) {
+		switch (CpuFeatures::GetSimd()) {
+#if defined(SIMD_BUILD_AVX2)
+		case SimdLevel::SL_Avx2: return kernel(SimdAvx2());
+#endif
+#if defined(SIMD_BUILD_SSE)
+		case SimdLevel::SL_Sse: return kernel(SimdSse());
+#endif
+		default: return 0;
+		}
+	}
+
+	// 비교 결과 bit를 0/1로 풀어서 저장
+	template<typename S>
+	inline void StoreMask(int32 mask, uint8* results) {
+		for (int32 i = 0; i < S::WIDTH; ++i)
+			results[i] = static_cast<uint8>((mask >> i) & 1);
+	}
+
+	// 원의 중심과 사각형 위의 가장 가까운 점 사이 거리의 제곱
+	template<typename S, typename floatN = typename S::floatN>
+	inline floatN ClosestDistanceSq(floatN cx, floatN cy, floatN minX, floatN minY, floatN maxX, floatN maxY) {
+		const floatN dx = S::Sub(cx, S::Min(S::Max(cx, minX), maxX));
+		const floatN dy = S::Sub(cy, S::Min(S::Max(cy, minY), maxY));
+		return S::Add(S::Mul(dx, dx), S::Mul(dy, dy));
+	}
+
+	// 아래 kernel들은 WIDTH개씩 검사할 수 있는 만큼 검사하고 검사한 수를 반환한다. (남은 것은 scalar)
+	template<typename S>
+	int32 BoxVsBoxesN(const ColliderArrays& arrays, int32 a, const int32* others, int32 count, uint8* results) {
+		using floatN = typename S::floatN;
+		const floatN minX = S::Set1(arrays.minX[a]);
+		const floatN minY = S::Set1(arrays.minY[a]);
+		const floatN maxX = S::Set1(arrays.maxX[a]);
+		const floatN maxY = S::Set1(arrays.maxY[a]);
+
+		int32 i = 0;
+		for (; i + S::WIDTH <= count; i += S::WIDTH) {
+			const int32* rows = others + i;
+			const floatN overlapX = S::Less(S::Max(minX, S::Gather(arrays.minX, rows)), S::Min(maxX, S::Gather(arrays.maxX, rows)));
+			const floatN overlapY = S::Less(S::Max(minY, S::Gather(arrays.minY, rows)), S::Min(maxY, S::Gather(arrays.maxY, rows)));
+			StoreMask<S>(S::MoveMask(S::And(overlapX, overlapY)), results + i);
+		}
+		return i;
+	}
+
+	template<typename S>
+	int32 BoxVsCirclesN(const ColliderArrays& arrays, int32 a, const int32* others, int32 count, uint8* results) {
+		using floatN = typename S::floatN;
+		const floatN minX = S::Set1(arrays.minX[a]);
+		const floatN minY = S::Set1(arrays.minY[a]);
+		const floatN maxX = S::Set1(arrays.maxX[a]);
+		const floatN maxY = S::Set1(arrays.maxY[a]);
+
+		int32 i = 0;
+		for (; i + S::WIDTH <= count; i += S::WIDTH) {
+			const int32* rows = others + i;
+			const floatN radius = S::Gather(arrays.radius, rows);
+			const floatN distSq = ClosestDistanceSq<S>(S::Gather(arrays.centerX, rows), S::Gather(arrays.centerY, rows), minX, minY, maxX, maxY);
+			StoreMask<S>(S::MoveMask(S::LessEqual(distSq, S::Mul(radius, radius))), results + i);
+		}
+		return i;
+	}
+
+	template<typename S>
+	int32 CircleVsBoxesN(const ColliderArrays& arrays, int32 a, const int32* others, int32 count, uint8* results) {
+		using floatN = typename S::floatN;
+		const floatN cx = S::Set1(arrays.centerX[a]);
+		const floatN cy = S::Set1(arrays.centerY[a]);
+		const floatN radiusSq = S::Set1(arrays.radius[a] * arrays.radius[a]);
+
+		int32 i = 0;
+		for (; i + S::WIDTH <= count; i += S::WIDTH) {
+			const int32* rows = others + i;
+			const floatN distSq = ClosestDistanceSq<S>(cx, cy,
+				S::Gather(arrays.minX, rows), S::Gather(arrays.minY, rows), S::Gather(arrays.maxX, rows), S::Gather(arrays.maxY, rows));
+			StoreMask<S>(S::MoveMask(S::LessEqual(distSq, radiusSq)), results + i);
+		}
+		return i;
+	}
+
+	template<typename S>
+	int32 CircleVsCirclesN(const ColliderArrays& arrays, int32 a, const int32* others, int32 count, uint8* results) {
+		using floatN = typename S::floatN;
+		const floatN cx = S::Set1(arrays.centerX[a]);
+		const floatN cy = S::Set1(arrays.centerY[a]);
+		const floatN radius = S::Set1(arrays.radius[a]);
+
+		int32 i = 0;
+		for (; i + S::WIDTH <= count; i += S::WIDTH) {
+			const int32* rows = others + i;
+			const floatN dx = S::Sub(cx, S::Gather(arrays.centerX, rows));
+			const floatN dy = S::Sub(cy, S::Gather(arrays.centerY, rows));
+			const floatN radiusSum = S::Add(radius, S::Gather(arrays.radius, rows));
+			const floatN distSq = S::Add(S::Mul(dx, dx), S::Mul(dy, dy));
+			StoreMask<S>(S::MoveMask(S::LessEqual(distSq, S::Mul(radiusSum, radiusSum))), results + i);
+		}
+		return i;
+	}
+}
+
+bool CollisionUtils::TestOverlap(const ColliderArrays& arrays, int32 a, int32 b)
+{
+	const ColliderType typeA = arrays.types[a];
+	const ColliderType typeB = arrays.types[b];
+
+	if (typeA == ColliderType::CT_Square && typeB == ColliderType::CT_Square)
+		return BoxToBox(arrays.minX[a], arrays.minY[a], arrays.maxX[a], arrays.maxY[a],
+			arrays.minX[b], arrays.minY[b], arrays.maxX[b], arrays.maxY[b]);
+
+	if (typeA == ColliderType::CT_Circle && typeB == ColliderType::CT_Circle)
+		return CircleToCircle(arrays.centerX[a], arrays.centerY[a], arrays.radius[a],
+			arrays.centerX[b], arrays.centerY[b], arrays.radius[b]);
+
+	// Circle - Square
+	const int32 circle = typeA == ColliderType::CT_Circle ? a : b;
+	const int32 square = typeA == ColliderType::CT_Circle ? b : a;
+	return CircleToBox(arrays.centerX[circle], arrays.centerY[circle], arrays.radius[circle],
+		arrays.minX[square], arrays.minY[square], arrays.maxX[square], arrays.maxY[square]);
+}
+
+Vector2D CollisionUtils::GetPenetration(const ColliderArrays& arrays, int32 a, int32 b)
+{
+	return GetPenetration(arrays.minX[a], arrays.minY[a], arrays.maxX[a], arrays.maxY[a],
+		arrays.minX[b], arrays.minY[b], arrays.maxX[b], arrays.maxY[b]);
+}
+
+Vector2D CollisionUtils::GetPenetration(float minX1, float minY1, float maxX1, float maxY1, float minX2, float minY2, float maxX2, float maxY2)
+{
+	// 겹친 영역
+	const float left = max(minX1, minX2);
+	const float top = max(minY1, minY2);
+	const float right = min(maxX1, maxX2);
+	const float bottom = min(maxY1, maxY2);
+
+	// 정확히 겹친 영역만큼만 계산한다면 border가 겹칠수 있다. (미세한만큼 추가로 보정해 계산해준다)
+	const float w = right - left + 1.f;
+	const float h = bottom - top + 1.f;
+
+	Vector2D intersect = Vector2D::Zero;
+	if (w > h) {
+		// 위에서 충돌했으면
+		intersect.Y = (top == minY2) ? h : -h;
+	}
+	else {
+		// 왼쪽에서 충돌했으면
+		intersect.X = (left == minX2) ? w : -w;
+	}
+
+	return intersect;
+}
+
+bool CollisionUtils::BoxToBox(float minX1, float minY1, float maxX1, float maxY1, float minX2, float minY2, float maxX2, float maxY2)
+{
+	return max(minX1, minX2) < min(maxX1, maxX2) && max(minY1, minY2) < min(maxY1, maxY2);
+}
+
+bool CollisionUtils::CircleToBox(float cx, float cy, float radius, float minX, float minY, float maxX, float maxY)
+{
+	// 사각형 안으로 clamp하면 가장 가까운 점 (중심이 사각형 안이면 거리 0)
+	const float dx = cx - min(max(cx, minX), maxX);
+	const float dy = cy - min(max(cy, minY), maxY);
+
+	return dx * dx + dy * dy <= radius * radius;
+}
+
+bool CollisionUtils::CircleToCircle(float cx1, float cy1, float radius1, float cx2, float cy2, float radius2)
+{
+	const float dx = cx1 - cx2;
+	const float dy = cy1 - cy2;
+	const float radiusSum = radius1 + radius2;
+
+	// 두 원의 중점끼리의 거리가 반지름의 합보다 작거나 같으면 true (양쪽 모두 제곱해서 비교)
+	return dx * dx + dy * dy <= radiusSum * radiusSum;
+}
+
+bool CollisionUtils::RayToBox(float originX, float originY, float dirX, float dirY, float minX, float minY, float maxX, float maxY, float& time, Vector2D& normal)
+{
+	// Slab : x축, y축 구간에 들어가는 시간과 나오는 시간을 구해 겹치는 구간을 찾는다.
+	const float origin[2] = { originX, originY };
+	const float dir[2] = { dirX, dirY };
+	const float mins[2] = { minX, minY };
+	const float maxs[2] = { maxX, maxY };
+
+	float enter = -FLT_MAX;
+	float exit = FLT_MAX;
+	Vector2D enterNormal = Vector2D::Zero;
+
+	for (int32 axis = 0; axis < 2; ++axis) {
+		// 축과 평행하게 움직이면 구간 밖에서는 절대 닿지 않는다. (경계만 닿는 것은 충돌 아님)
+		if (std::abs(dir[axis]) < FLT_EPSILON) {
+			if (origin[axis] <= mins[axis] || origin[axis] >= maxs[axis])
+				return false;
+			continue;
+		}
+
+		const float invDir = 1.f / dir[axis];
+		float t1 = (mins[axis] - origin[axis]) * invDir;
+		float t2 = (maxs[axis] - origin[axis]) * invDir;
+		float side = -1.f; // min 쪽 면으로 들어감
+		if (t1 > t2) {
+			std::swap(t1, t2);
+			side = 1.f;
+		}
+
+		if (t1 > enter) {
+			enter = t1;
+			enterNormal = axis == 0 ? Vector2D(side, 0.f) : Vector2D(0.f, side);
+		}
+		exit = min(exit, t2);
+	}
+
+	if (enter >= exit || exit <= 0.f || enter > 1.f)
+		return false;
+
+	// 시작부터 안에 있으면 0
+	if (enter < 0.f) {
+		time = 0.f;
+		normal = Vector2D::Zero;
+		return true;
+	}
+
+	time = enter;
+	normal = enterNormal;
+	return true;
+}
+
+bool CollisionUtils::RayToCircle(float originX, float originY, float dirX, float dirY, float cx, float cy, float radius, float& time, Vector2D& normal)
+{
+	// |origin + dir * t - center|^2 = radius^2 의 작은 근
+	const float mx = originX - cx;
+	const float my = originY - cy;
+	const float c = mx * mx + my * my - radius * radius;
+
+	// CircleToCircle과 같이 경계도 충돌로 본다.
+	if (c <= 0.f) {
+		time = 0.f;
+		normal = Vector2D::Zero;
+		return true;
+	}
+
+	const float a = dirX * dirX + dirY * dirY;
+	const float b = mx * dirX + my * dirY;
+	if (a < FLT_EPSILON || b >= 0.f) // 움직이지 않거나 멀어지는 중
+		return false;
+
+	const float discriminant = b * b - a * c;
+	if (discriminant < 0.f)
+		return false;
+
+	const float t = (-b - std::sqrt(discriminant)) / a;
+	if (t > 1.f)
+		return false;
+
+	time = t;
+	normal = Vector2D(mx + dirX * t, my + dirY * t) * (1.f / radius);
+	return true;
+}
+
+bool CollisionUtils::SweptBoxToBox(float minX1, float minY1, float maxX1, float maxY1, float minX2, float minY2, float maxX2, float maxY2, float moveX, float moveY, float& time, Vector2D& normal)
+{
+	// 2번 사각형을 1번 사각형 크기만큼 키우면 1번 사각형의 중심이 움직이는 선분 검사와 같다. (Minkowski 합)
+	const float halfX = (maxX1 - minX1) * 0.5f;
+	const float halfY = (maxY1 - minY1) * 0.5f;
+
+	return RayToBox(minX1 + halfX, minY1 + halfY, moveX, moveY,
+		minX2 - halfX, minY2 - halfY, maxX2 + halfX, maxY2 + halfY, time, normal);
+}
+
+bool CollisionUtils::SweptCircleToBox(float cx, float cy, float radius, float minX, float minY, float maxX, float maxY, float moveX, float moveY, float& time, Vector2D& normal)
+{
+	// 사각형을 반지름만큼 키운 모서리가 둥근 사각형 = 가로, 세로로 키운 사각형 2개 + 꼭지점 원 4개
+	bool hit = false;
+	float bestTime = FLT_MAX;
+	Vector2D bestNormal = Vector2D::Zero;
+
+	float t = 0.f;
+	Vector2D n = Vector2D::Zero;
+	auto keepFirst = [&](bool result) {
+		if (result && t < bestTime) {
+			hit = true;
+			bestTime = t;
+			bestNormal = n;
+		}
+	};
+
+	keepFirst(RayToBox(cx, cy, moveX, moveY, minX - radius, minY, maxX + radius, maxY, t, n));
+	keepFirst(RayToBox(cx, cy, moveX, moveY, minX, minY - radius, maxX, maxY + radius, t, n));
+	keepFirst(RayToCircle(cx, cy, moveX, moveY, minX, minY, radius, t, n));
+	keepFirst(RayToCircle(cx, cy, moveX, moveY, maxX, minY, radius, t, n));
+	keepFirst(RayToCircle(cx, cy, moveX, moveY, minX, maxY, radius, t, n));
+	keepFirst(RayToCircle(cx, cy, moveX, moveY, maxX, maxY, radius, t, n));
+
+	if (hit == false)
+		return false;
+
+	time = bestTime;
+	normal = bestNormal;
+	return true;
+}
+
+bool CollisionUtils::SweptCircleToCircle(float cx1, float cy1, float radius1, float cx2, float cy2, float radius2, float moveX, float moveY, float& time, Vector2D& normal)
+{
+	// 2번 원의 반지름을 1번 원의 반지름만큼 키우면 선분 검사와 같다.
+	return RayToCircle(cx1, cy1, moveX, moveY, cx2, cy2, radius1 + radius2, time, normal);
+}
+
+bool CollisionUtils::SweptTest(const ColliderArrays& arrays, int32 a, int32 b, float& time, Vector2D& normal)
+{
+	// 이전 Tick 위치에서 시작 (b가 멈춰있다고 보고 a가 상대 이동량만큼 움직인다)
+	const float offsetAX = arrays.prevCenterX[a] - arrays.centerX[a];
+	const float offsetAY = arrays.prevCenterY[a] - arrays.centerY[a];
+	const float offsetBX = arrays.prevCenterX[b] - arrays.centerX[b];
+	const float offsetBY = arrays.prevCenterY[b] - arrays.centerY[b];
+	const float moveX = offsetBX - offsetAX;
+	const float moveY = offsetBY - offsetAY;
+
+	const ColliderType typeA = arrays.types[a];
+	const ColliderType typeB = arrays.types[b];
+
+	if (typeA == ColliderType::CT_Square && typeB == ColliderType::CT_Square)
+		return SweptBoxToBox(arrays.minX[a] + offsetAX, arrays.minY[a] + offsetAY, arrays.maxX[a] + offsetAX, arrays.maxY[a] + offsetAY,
+			arrays.minX[b] + offsetBX, arrays.minY[b] + offsetBY, arrays.maxX[b] + offsetBX, arrays.maxY[b] + offsetBY, moveX, moveY, time, normal);
+
+	if (typeA == ColliderType::CT_Circle && typeB == ColliderType::CT_Circle)
+		return SweptCircleToCircle(arrays.prevCenterX[a], arrays.prevCenterY[a], arrays.radius[a],
+			arrays.prevCenterX[b], arrays.prevCenterY[b], arrays.radius[b], moveX, moveY, time, normal);
+
+	if (typeA == ColliderType::CT_Circle)
+		return SweptCircleToBox(arrays.prevCenterX[a], arrays.prevCenterY[a], arrays.radius[a],
+			arrays.minX[b] + offsetBX, arrays.minY[b] + offsetBY, arrays.maxX[b] + offsetBX, arrays.maxY[b] + offsetBY, moveX, moveY, time, normal);
+
+	// Square - Circle : 원이 반대로 움직인다고 보고 검사한 뒤 방향을 뒤집는다.
+	if (SweptCircleToBox(arrays.prevCenterX[b], arrays.prevCenterY[b], arrays.radius[b],
+		arrays.minX[a] + offsetAX, arrays.minY[a] + offsetAY, arrays.maxX[a] + offsetAX, arrays.maxY[a] + offsetAY, -moveX, -moveY, time, normal) == false)
+		return false;
+
+	normal = -normal;
+	return true;
+}
+
+void CollisionUtils::BoxVsBoxes(const ColliderArrays& arrays, int32 a, const int32* others, int32 count, uint8* results)
+{
+	int32 i = RunBatch([&](auto simd) { return BoxVsBoxesN<decltype(simd)>(arrays, a, others, count, results); });
+
+	for (; i < count; ++i) {
+		const int32 b = others[i];
+		results[i] = BoxToBox(arrays.minX[a], arrays.minY[a], arrays.maxX[a], arrays.maxY[a],
+			arrays.minX[b], arrays.minY[b], arrays.maxX[b], arrays.maxY[b]);
+	}
+}
+
+void CollisionUtils::BoxVsCircles(const ColliderArrays& arrays, int32 a, const int32* others, int32 count, uint8* results)
+{
+	int32 i = RunBatch([&](auto simd) { return BoxVsCirclesN<decltype(simd)>(arrays, a, others, count, results); });
+
+	for (; i < count; ++i) {
+		const int32 b = others[i];
+		results[i] = CircleToBox(arrays.centerX[b], arrays.centerY[b], arrays.radius[b],
+			arrays.minX[a], arrays.minY[a], arrays.maxX[a], arrays.maxY[a]);
+	}
+}
+
+void CollisionUtils::CircleVsBoxes(const ColliderArrays& arrays, int32 a, const int32* others, int32 count, uint8* results)
+{
+	int32 i = RunBatch([&](auto simd) { return CircleVsBoxesN<decltype(simd)>(arrays, a, others, count, results); });
+
+	for (; i < count; ++i) {
+		const int32 b = others[i];
+		results[i] = CircleToBox(arrays.centerX[a], arrays.centerY[a], arrays.radius[a],
+			arrays.minX[b], arrays.minY[b], arrays.maxX[b], arrays.maxY[b]);
+	}
+}
+
+void CollisionUtils::CircleVsCircles(const ColliderArrays& arrays, int32 a, const int32* others, int32 count, uint8* results)
+{
+	int32 i = RunBatch([&](auto simd) { return CircleVsCirclesN<decltype(simd)>(arrays, a, others, count, results); });
+
+	for (; i < count; ++i) {
+		const int32 b = others[i];
+		results[i] = CircleToCircle(arrays.centerX[a], arrays.centerY[a], arrays.radius[a],
+			arrays.centerX[b], arrays.centerY[b], arrays.radius[b]);
+	}
+}
+
+int32 CollisionUtils::GetBatchWidth()
+{
+	return CpuFeatures::GetSimdWidth(CpuFeatures::GetSimd());
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+struct ColliderArrays;
+
+// ColliderArrays(plain float 배열)를 사용하는 narrowphase
+struct CollisionUtils
+{
+	// 두 row의 Collider가 겹치는지 (ColliderType에 따라 아래 함수 중 하나로 검사)
+	static bool TestOverlap(const ColliderArrays& arrays, int32 a, int32 b);
+
+	// a가 b에서 빠져나가기 위해 되돌아가야 할 만큼 (Square끼리만)
+	static Vector2D GetPenetration(const ColliderArrays& arrays, int32 a, int32 b);
+	static Vector2D GetPenetration(float minX1, float minY1, float maxX1, float maxY1, float minX2, float minY2, float maxX2, float maxY2);
+
+public:
+	// 경계만 닿은 경우는 충돌하지 않은 것으로 본다. (::IntersectRect와 같은 기준)
+	static bool BoxToBox(float minX1, float minY1, float maxX1, float maxY1, float minX2, float minY2, float maxX2, float maxY2);
+	// 사각형 위에서 원의 중심과 가장 가까운 점이 원 안에 있는지
+	static bool CircleToBox(float cx, float cy, float radius, float minX, float minY, float maxX, float maxY);
+	// sqrt 없이 거리의 제곱으로 비교
+	static bool CircleToCircle(float cx1, float cy1, float radius1, float cx2, float cy2, float radius2);
+
+public:
+	/*
+		선분(origin ~ origin + dir) 검사
+			- time = 처음 닿는 지점의 비율 (0 ~ 1), 시작점이 이미 안에 있으면 0
+			- normal = 닿은 면에서 바깥쪽 방향 (시작점이 안에 있으면 Zero)
+	*/
+	static bool RayToBox(float originX, float originY, float dirX, float dirY, float minX, float minY, float maxX, float maxY, float& time, Vector2D& normal);
+	static bool RayToCircle(float originX, float originY, float dirX, float dirY, float cx, float cy, float radius, float& time, Vector2D& normal);
+
+	/*
+		Swept narrowphase (continuous)
+			- 앞쪽 도형이 (moveX, moveY)만큼 이동하는 동안 뒤쪽 도형과 부딪히는지 (뒤쪽 도형은 멈춰있다고 본다)
+			- 둘 다 움직이면 상대 이동량(a의 이동 - b의 이동)을 넘긴다.
+			- time, normal은 RayTo*와 같다. (normal = 뒤쪽 도형에서 앞쪽 도형을 향하는 방향)
+	*/
+	static bool SweptBoxToBox(float minX1, float minY1, float maxX1, float maxY1, float minX2, float minY2, float maxX2, float maxY2, float moveX, float moveY, float& time, Vector2D& normal);
+	static bool SweptCircleToBox(float cx, float cy, float radius, float minX, float minY, float maxX, float maxY, float moveX, float moveY, float& time, Vector2D& normal);
+	static bool SweptCircleToCircle(float cx1, float cy1, float radius1, float cx2, float cy2, float radius2, float moveX, float moveY, float& time, Vector2D& normal);
+
+	// 두 row의 이전 Tick 위치 -> 현재 위치 이동으로 검사 (normal = b에서 a를 향하는 방향)
+	static bool SweptTest(const ColliderArrays& arrays, int32 a, int32 b, float& time, Vector2D& normal);
+
+public:
+	/*
+		Batch narrowphase
+			- row a 하나를 others(row)들과 한번에 검사한다. (AVX2 = 8개, SSE = 4개씩, 남은 것은 scalar)
+			- AVX2 / SSE는 실행할 때 CPU에 맞춰 고른다. (CpuFeatures)
+			- others는 모두 같은 ColliderType이어야 한다. (함수 이름의 뒤쪽)
+			- results[i] = others[i]와 겹쳤으면 1, 아니면 0
+	*/
+	static void BoxVsBoxes(const ColliderArrays& arrays, int32 a, const int32* others, int32 count, uint8* results);
+	static void BoxVsCircles(const ColliderArrays& arrays, int32 a, const int32* others, int32 count, uint8* results);
+	static void CircleVsBoxes(const ColliderArrays& arrays, int32 a, const int32* others, int32 count, uint8* results);
+	static void CircleVsCircles(const ColliderArrays& arrays, int32 a, const int32* others, int32 count, uint8* results);
+
+	// 지금 사용되는 batch 크기 (1 = scalar)
+	static int32 GetBatchWidth();
+};
@@ -0,0 +1,67 @@
+#include "pch.h"
+#include "CpuFeatures.h"
+#include <intrin.h>
+
+SimdLevel CpuFeatures::GetSupportedSimd()
+{
+	static const SimdLevel supported = Detect();
+	return supported;
+}
+
+void CpuFeatures::SetSimd(SimdLevel level)
+{
+	GetSelected() = min(level, GetSupportedSimd());
+}
+
+const wchar_t* CpuFeatures::GetSimdName(SimdLevel level)
+{
+	switch (level) {
+	case SimdLevel::SL_Avx2: return L"AVX2";
+	case SimdLevel::SL_Sse: return L"SSE2";
+	default: return L"Scalar";
+	}
+}
+
+int32 CpuFeatures::GetSimdWidth(SimdLevel level)
+{
+	switch (level) {
+	case SimdLevel::SL_Avx2: return 8;
+	case SimdLevel::SL_Sse: return 4;
+	default: return 1;
+	}
+}
+
+SimdLevel CpuFeatures::Detect()
+{
+	SimdLevel level = SimdLevel::SL_Scalar;
+
+#if defined(SIMD_BUILD_SSE)
+	int32 info[4] = {};
+	__cpuid(info, 0);
+	const int32 maxLeaf = info[0];
+
+	__cpuid(info, 1);
+	const bool sse2 = (info[3] & (1 << 26)) != 0;
+	const bool osxsave = (info[2] & (1 << 27)) != 0;
+	const bool avx = (info[2] & (1 << 28)) != 0;
+	if (sse2)
+		level = SimdLevel::SL_Sse;
+
+#if defined(SIMD_BUILD_AVX2)
+	// OS가 YMM register를 저장해줘야 AVX를 쓸 수 있다. (XCR0의 SSE, AVX bit)
+	if (sse2 && osxsave && avx && maxLeaf >= 7 && (_xgetbv(0) & 0x6) == 0x6) {
+		__cpuidex(info, 7, 0);
+		if ((info[1] & (1 << 5)) != 0)
+			level = SimdLevel::SL_Avx2;
+	}
+#endif
+#endif
+
+	return level;
+}
+
+SimdLevel& CpuFeatures::GetSelected()
+{
+	static SimdLevel selected = GetSupportedSimd();
+	return selected;
+}
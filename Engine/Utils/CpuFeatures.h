@@ -0,0 +1,33 @@
+#pragma once
+
+// x86/x64 MSVC는 /arch 설정과 관계없이 intrinsic을 쓸 수 있으므로 AVX2 코드도 항상 빌드하고 실행할 때 고른다.
+#if defined(_M_X64) || defined(_M_IX86) || defined(__AVX2__)
+#define SIMD_BUILD_AVX2
+#endif
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define SIMD_BUILD_SSE
+#endif
+
+/*
+	CpuFeatures
+		- 처음 사용할 때 CPUID로 CPU(와 OS)가 지원하는 SIMD를 확인한다.
+		- CollisionUtils, BlitUtils의 batch 함수는 GetSimd()에 따라 AVX2 / SSE2 / scalar 중 하나로 실행한다.
+*/
+struct CpuFeatures
+{
+	// CPU와 빌드가 모두 지원하는 가장 높은 단계
+	static SimdLevel GetSupportedSimd();
+
+	// batch 함수가 사용하는 단계 (기본 = GetSupportedSimd)
+	static SimdLevel GetSimd() { return GetSelected(); }
+	// benchmark에서 낮춰서 비교할 때 사용 (지원하지 않는 단계는 지원하는 가장 높은 단계로)
+	static void SetSimd(SimdLevel level);
+
+	static const wchar_t* GetSimdName(SimdLevel level);
+	// 한번에 처리하는 수 (1 = scalar)
+	static int32 GetSimdWidth(SimdLevel level);
+
+private:
+	static SimdLevel Detect();
+	static SimdLevel& GetSelected();
+};
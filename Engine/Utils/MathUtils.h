@@ -10,16 +10,16 @@ struct MathUtils
 	static constexpr float HalfPI = { 1.57079632679f };
 	static constexpr float InvPI = { 0.31830988618f };
 
-	// :	̵   - ̵(å)
-	// 𸮾  ڵ忡 .    ( 1 / sqrt(x) )
+	// 참조:	이득우의 게임 수학 - 이득우(책)
+	// 언리얼 엔진 코드에서 가져옴. 고속 역제곱근 공식 ( 1 / sqrt(x) )
 	FORCEINLINE static float InvSqrt(float InFloat)
 	{
 		/*
-			͸   ũ ִ  ִµ
-			̶ Ǽ  sqrt(x)  ɸ.
+			단위벡터를 만들 때 크기로 나눠주는 과정이 있는데
+			이때 실수 나눗셈과 sqrt(x) 계산은 오래걸린다.
 
-			׷ 1/sqrt(x)  ؾϴ   ȿ  ʿϴ.
-			InvSqrt ˰ ,  Ʈ 길 ̿ 1 / sqrt(x) 1% ̳   ش.
+			그래서 1/sqrt(x)를 많이 구해야하는 경우 더 효율적인 방법이 필요하다.
+			InvSqrt 알고리즘은 덧셈, 곱셈과 비트 연산만 이용해 1 / sqrt(x)를 1% 이내의 오차로 빠르게 구해준다.
 		*/
 
 		// Performs two passes of Newton-Raphson iteration on the hardware estimate
@@ -59,10 +59,10 @@ struct MathUtils
 		return temp;
 	}
 
-	// H = | x1 - x1 | + | y2 - y1 |,  +  ̵
+	// H = | x1 - x1 | + | y2 - y1 |, 수평 + 수직 이동
 	static int32 Manhattan(const Vector2D& a, const Vector2D& b);
 
-	// H = sqrt( (x2 - x1)^2 + (y2 - y1)^2 ),  +  + 밢
+	// H = sqrt( (x2 - x1)^2 + (y2 - y1)^2 ), 수평 + 수직 + 대각선
 	static int32 Euclidean(const Vector2D& a, const Vector2D& b);
 
 	static float LinearInterpolation(const float& a, const float& b, const float& t);
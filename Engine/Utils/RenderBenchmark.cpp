@@ -0,0 +1,518 @@
+#include "pch.h"
+#include "RenderBenchmark.h"
+#include "CollisionBenchmark.h"
+#include "Engine.h"
+#include "World\World.h"
+#include "World\Level.h"
+#include "Manager\InputManager.h"
+#include "Manager\AssetManager.h"
+#include "Render\FrameBuffer.h"
+#include "Render\DirtyRegion.h"
+#include "Render\DrawList.h"
+#include "Render\TileRasterizer.h"
+#include "Manager\ThreadManager.h"
+#include "BlitUtils.h"
+#include "CpuFeatures.h"
+#include "Resources\Texture.h"
+#include <random>
+#include <chrono>
+
+namespace {
+	template<typename Func>
+	double MeasureMs(int32 iterations, Func&& func)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		for (int32 i = 0; i < iterations; ++i)
+			func();
+		const auto end = std::chrono::steady_clock::now();
+
+		return std::chrono::duration<double, std::milli>(end - start).count();
+	}
+}
+
+std::wstring RenderBenchmark::Run(const std::vector<std::wstring>& args)
+{
+	std::wstring report;
+
+	if (CollisionBenchmark::HasArg(args, L"render"))
+		report += RunFrames();
+	if (CollisionBenchmark::HasArg(args, L"blit"))
+		report += RunBlit();
+	if (CollisionBenchmark::HasArg(args, L"spans"))
+		report += RunSpans();
+	if (CollisionBenchmark::HasArg(args, L"dirty"))
+		report += RunDirty();
+	if (CollisionBenchmark::HasArg(args, L"tiles"))
+		report += RunTiles();
+	if (CollisionBenchmark::HasArg(args, L"alpha"))
+		report += RunAlpha();
+
+	return report;
+}
+
+std::wstring RenderBenchmark::RunFrames(int32 frames)
+{
+	// 창이 없으므로 Texture는 GDI 없이 pixel만 가진다.
+	GET_SINGLE(InputManager)->Init(nullptr);
+	GET_SINGLE(AssetManager)->Init(nullptr);
+
+	World world;
+	world.Init();
+
+	FrameBuffer frameBuffer(Engine::GetScreenWidth(), Engine::GetScreenHeight());
+	DrawList drawList;
+
+	// 모든 명령을 모은 뒤 한 thread로 전체를 그린다. (DirtyRectRenderer 없이)
+	auto renderFrame = [&]() {
+		drawList.Begin(frameBuffer.GetWidth(), frameBuffer.GetHeight());
+		world.Render(drawList);
+		frameBuffer.Clear(RGB(255, 255, 255));
+		drawList.Execute(frameBuffer);
+	};
+
+	// 첫 frame은 준비 비용이 섞이므로 제외
+	world.Tick();
+	renderFrame();
+
+	double tickMs = 0.0;
+	double renderMs = 0.0;
+	double maxRenderMs = 0.0;
+	int64 renderedActors = 0;
+	int64 culledActors = 0;
+	for (int32 i = 0; i < frames; ++i) {
+		const auto start = std::chrono::steady_clock::now();
+		world.Tick();
+		const auto ticked = std::chrono::steady_clock::now();
+
+		renderFrame();
+		const auto rendered = std::chrono::steady_clock::now();
+
+		tickMs += std::chrono::duration<double, std::milli>(ticked - start).count();
+		const double ms = std::chrono::duration<double, std::milli>(rendered - ticked).count();
+		renderMs += ms;
+		maxRenderMs = max(maxRenderMs, ms);
+
+		if (std::shared_ptr<Level> level = World::GetCurrentLevel()) {
+			renderedActors += level->GetRenderStats().rendered;
+			culledActors += level->GetRenderStats().culled;
+		}
+	}
+
+	frameBuffer.SaveBmp(L"RenderBenchmark.bmp");
+
+	const double count = max(1, frames);
+	std::wstring report = std::format(L"[Render] {}x{} software, frames: {}\n", frameBuffer.GetWidth(), frameBuffer.GetHeight(), frames);
+	report += std::format(L"  tick   : {:.3f} ms/frame\n", tickMs / count);
+	report += std::format(L"  render : {:.3f} ms/frame (max {:.3f} ms)\n", renderMs / count, maxRenderMs);
+	report += std::format(L"  actors : {:.1f} rendered, {:.1f} culled /frame\n", renderedActors / count, culledActors / count);
+	return report;
+}
+
+std::wstring RenderBenchmark::RunBlit(int32 blitCount, int32 iterations)
+{
+	const int32 width = Engine::GetScreenWidth();
+	const int32 height = Engine::GetScreenHeight();
+
+	// sprite처럼 가운데는 불투명하고 바깥은 투명(key)한 texture
+	constexpr int32 SPRITE_SIZE = 128;
+	const uint32 key = BlitUtils::ToPixel(RGB(255, 0, 255));
+	std::vector<uint32> sprite(SPRITE_SIZE * SPRITE_SIZE);
+	for (int32 y = 0; y < SPRITE_SIZE; ++y) {
+		for (int32 x = 0; x < SPRITE_SIZE; ++x) {
+			const int32 dx = x - SPRITE_SIZE / 2;
+			const int32 dy = y - SPRITE_SIZE / 2;
+			const bool opaque = dx * dx + dy * dy < (SPRITE_SIZE / 2 - 8) * (SPRITE_SIZE / 2 - 8);
+			sprite[y * SPRITE_SIZE + x] = opaque ? ((x * 2) << 16) | ((y * 2) << 8) | 0x40 : key;
+		}
+	}
+
+	// 일부는 화면 밖에 걸치도록
+	std::mt19937 rng(1234);
+	std::uniform_int_distribution<int32> xDist(-SPRITE_SIZE / 2, width - SPRITE_SIZE / 2);
+	std::uniform_int_distribution<int32> yDist(-SPRITE_SIZE / 2, height - SPRITE_SIZE / 2);
+	std::vector<std::pair<int32, int32>> positions(blitCount);
+	int64 pixelCount = 0;
+	for (auto& [x, y] : positions) {
+		x = xDist(rng);
+		y = yDist(rng);
+
+		int32 clipX = x, clipY = y, srcX = 0, srcY = 0, w = SPRITE_SIZE, h = SPRITE_SIZE;
+		if (BlitUtils::Clip(width, height, clipX, clipY, SPRITE_SIZE, SPRITE_SIZE, srcX, srcY, w, h))
+			pixelCount += static_cast<int64>(w) * h;
+	}
+
+	std::vector<uint32> naiveResult(static_cast<size_t>(width) * height);
+	std::vector<uint32> scalarResult(naiveResult.size());
+
+	// pixel마다 화면 안인지 검사하는 단순 loop
+	const double naiveMs = MeasureMs(iterations, [&]() {
+		for (const auto& [x, y] : positions) {
+			for (int32 row = 0; row < SPRITE_SIZE; ++row) {
+				for (int32 col = 0; col < SPRITE_SIZE; ++col) {
+					const int32 destX = x + col;
+					const int32 destY = y + row;
+					if (destX < 0 || destY < 0 || destX >= width || destY >= height)
+						continue;
+
+					const uint32 pixel = sprite[row * SPRITE_SIZE + col];
+					if (pixel != key)
+						naiveResult[static_cast<size_t>(destY) * width + destX] = pixel;
+				}
+			}
+		}
+	});
+
+	// 미리 잘라두고 한 줄씩 scalar
+	const double scalarMs = MeasureMs(iterations, [&]() {
+		for (auto [x, y] : positions) {
+			int32 srcX = 0, srcY = 0, w = SPRITE_SIZE, h = SPRITE_SIZE;
+			if (BlitUtils::Clip(width, height, x, y, SPRITE_SIZE, SPRITE_SIZE, srcX, srcY, w, h) == false)
+				continue;
+			for (int32 row = 0; row < h; ++row)
+				BlitUtils::ColorKeyRowScalar(&scalarResult[static_cast<size_t>(y + row) * width + x], &sprite[(srcY + row) * SPRITE_SIZE + srcX], w, key);
+		}
+	});
+
+	// 모두 같은 결과여야 한다.
+	int64 scalarMismatch = 0;
+	for (size_t i = 0; i < naiveResult.size(); ++i)
+		scalarMismatch += naiveResult[i] != scalarResult[i];
+
+	auto toMpixels = [&](double ms) { return static_cast<double>(pixelCount) * iterations / (ms * 1000.0); };
+
+	std::wstring report = std::format(L"[Color-key Blit] {}x{} sprite, blits: {}, pixels: {}, iterations: {}\n",
+		SPRITE_SIZE, SPRITE_SIZE, blitCount, pixelCount, iterations);
+	report += std::format(L"  Naive loop            : {:.1f} Mpixel/s\n", toMpixels(naiveMs));
+	report += std::format(L"  Scalar                : {:.1f} Mpixel/s\n", toMpixels(scalarMs));
+
+	// CPU가 지원하는 SIMD 단계마다 BlitColorKey (ColorKeyRow)
+	std::wstring mismatches = std::format(L"Scalar != Naive: {}", scalarMismatch);
+	const SimdLevel prevSimd = CpuFeatures::GetSimd();
+	const SimdLevel supported = CpuFeatures::GetSupportedSimd();
+	for (SimdLevel level : { SimdLevel::SL_Sse, SimdLevel::SL_Avx2 }) {
+		if (level > supported)
+			break;
+
+		CpuFeatures::SetSimd(level);
+		std::vector<uint32> simdResult(naiveResult.size());
+		const double simdMs = MeasureMs(iterations, [&]() {
+			for (const auto& [x, y] : positions)
+				BlitUtils::BlitColorKey(simdResult.data(), width, height, x, y, sprite.data(), SPRITE_SIZE, SPRITE_SIZE, 0, 0, SPRITE_SIZE, SPRITE_SIZE, key);
+		});
+
+		int64 simdMismatch = 0;
+		for (size_t i = 0; i < naiveResult.size(); ++i)
+			simdMismatch += naiveResult[i] != simdResult[i];
+
+		report += std::format(L"  {:<4} (width {})        : {:.1f} Mpixel/s\n", CpuFeatures::GetSimdName(level), BlitUtils::GetBatchWidth(), toMpixels(simdMs));
+		mismatches += std::format(L", {} != Naive: {}", CpuFeatures::GetSimdName(level), simdMismatch);
+	}
+	CpuFeatures::SetSimd(prevSimd);
+
+	report += std::format(L"  {}\n", mismatches);
+
+	return report;
+}
+
+std::wstring RenderBenchmark::RunSpans(int32 iterations)
+{
+	// GameLevel을 만들면서 sprite sheet들을 Load
+	GET_SINGLE(InputManager)->Init(nullptr);
+	GET_SINGLE(AssetManager)->Init(nullptr);
+
+	World world;
+	world.Init();
+
+	std::map<std::wstring, std::shared_ptr<Texture>> textures(GET_SINGLE(AssetManager)->GetTextures().begin(), GET_SINGLE(AssetManager)->GetTextures().end());
+
+	std::wstring report = std::format(L"[Color-key Spans] sheets: {}, iterations: {}\n", textures.size(), iterations);
+	report += L"  sheet          size       opaque   full KB  spans KB  RLE KB  color-key ms  spans ms  speedup  mismatch\n";
+
+	for (const auto& [name, texture] : textures) {
+		const int32 width = texture->GetWidth();
+		const int32 height = texture->GetHeight();
+		const ColorKeySpans& spans = texture->GetSpans();
+		const uint32 key = BlitUtils::ToPixel(texture->GetTransparent());
+
+		// sheet 전체를 같은 크기의 버퍼에 그린다.
+		std::vector<uint32> colorKeyResult(static_cast<size_t>(width) * height);
+		std::vector<uint32> spanResult(colorKeyResult.size());
+
+		const double colorKeyMs = MeasureMs(iterations, [&]() {
+			BlitUtils::BlitColorKey(colorKeyResult.data(), width, height, 0, 0, texture->GetPixels(), width, height, 0, 0, width, height, key);
+		}) / iterations;
+		const double spanMs = MeasureMs(iterations, [&]() {
+			BlitUtils::BlitSpans(spanResult.data(), width, height, 0, 0, texture->GetPixels(), width, height, 0, 0, width, height, spans);
+		}) / iterations;
+
+		int64 mismatch = 0;
+		for (size_t i = 0; i < colorKeyResult.size(); ++i)
+			mismatch += colorKeyResult[i] != spanResult[i];
+
+		// RLE = 구간 정보 + 불투명한 pixel만 저장했을 때의 크기
+		const double fullKB = static_cast<double>(colorKeyResult.size() * sizeof(uint32)) / 1024.0;
+		const double spansKB = static_cast<double>(spans.GetMemorySize()) / 1024.0;
+		const double rleKB = spansKB + static_cast<double>(spans.GetOpaqueCount() * sizeof(uint32)) / 1024.0;
+		const double opaque = 100.0 * static_cast<double>(spans.GetOpaqueCount()) / max(1.0, static_cast<double>(colorKeyResult.size()));
+
+		report += std::format(L"  {:<14} {:>4}x{:<4}  {:>5.1f}%  {:>8.1f}  {:>8.1f}  {:>6.1f}  {:>12.3f}  {:>8.3f}  {:>6.2f}x  {}\n",
+			name, width, height, opaque, fullKB, spansKB, rleKB, colorKeyMs, spanMs, colorKeyMs / max(spanMs, 1e-6), mismatch);
+	}
+
+	return report;
+}
+
+std::wstring RenderBenchmark::RunDirty(int32 frames)
+{
+	GET_SINGLE(InputManager)->Init(nullptr);
+	GET_SINGLE(AssetManager)->Init(nullptr);
+
+	World world;
+	world.Init();
+
+	const int32 width = Engine::GetScreenWidth();
+	const int32 height = Engine::GetScreenHeight();
+	FrameBuffer full(width, height);
+	DrawList fullList;
+	FrameBuffer dirty(width, height);
+	DirtyRectRenderer renderer;
+	Vector2D lastCameraPos = World::GetCameraPos();
+
+	double fullMs = 0.0;
+	double dirtyMs = 0.0;
+	int64 redrawn = 0;
+	int32 fullFrames = 0;
+	int32 mismatches = 0;
+	for (int32 i = 0; i < frames; ++i) {
+		world.Tick();
+
+		// 기존 방식 : 전체를 지우고 다시 그리기
+		fullMs += MeasureMs(1, [&]() {
+			fullList.Begin(width, height);
+			world.Render(fullList);
+			full.Clear(RGB(255, 255, 255));
+			fullList.Execute(full);
+		});
+
+		// Engine::Render와 같다.
+		dirtyMs += MeasureMs(1, [&]() {
+			if (World::GetCameraPos() != lastCameraPos) {
+				lastCameraPos = World::GetCameraPos();
+				renderer.MarkFullRedraw();
+			}
+			world.Render(renderer.BeginFrame(width, height));
+			renderer.EndFrame(dirty, RGB(255, 255, 255));
+		});
+
+		redrawn += renderer.GetDirtyRegion().GetArea();
+		if (renderer.GetDirtyRegion().IsFull())
+			++fullFrames;
+		if (::memcmp(full.GetPixels(), dirty.GetPixels(), static_cast<size_t>(width) * height * sizeof(uint32)) != 0)
+			++mismatches;
+	}
+
+	const double count = max(1, frames);
+	std::wstring report = std::format(L"[Dirty] {}x{} software, frames: {}\n", width, height, frames);
+	report += std::format(L"  full redraw : {:.3f} ms/frame\n", fullMs / count);
+	report += std::format(L"  dirty rects : {:.3f} ms/frame, redrawn {:.1f}% of screen, full frames: {}\n",
+		dirtyMs / count, 100.0 * redrawn / (count * width * height), fullFrames);
+	report += std::format(L"  mismatched frames: {}\n", mismatches);
+	return report;
+}
+
+std::wstring RenderBenchmark::RunTiles(int32 spriteCount, int32 iterations)
+{
+	// GameLevel이 Load하는 sprite sheet 사용
+	GET_SINGLE(InputManager)->Init(nullptr);
+	GET_SINGLE(AssetManager)->Init(nullptr);
+
+	World world;
+	world.Init();
+
+	std::map<std::wstring, std::shared_ptr<Texture>> textureMap(GET_SINGLE(AssetManager)->GetTextures().begin(), GET_SINGLE(AssetManager)->GetTextures().end());
+	std::vector<std::shared_ptr<Texture>> textures;
+	for (const auto& [name, texture] : textureMap) {
+		if (texture->GetWidth() > 0 && texture->GetHeight() > 0)
+			textures.push_back(texture);
+	}
+	if (textures.empty())
+		return L"[Tiles] no texture\n";
+
+	const int32 maxThreadCount = max(1, static_cast<int32>(std::thread::hardware_concurrency()));
+	std::vector<int32> threadCounts;
+	for (int32 count = 1; count < maxThreadCount; count *= 2)
+		threadCounts.push_back(count);
+	threadCounts.push_back(maxThreadCount);
+
+	std::wstring report = std::format(L"[Tiles] sprites: {}, iterations: {}, CPU threads: {}\n", spriteCount, iterations, maxThreadCount);
+	// core가 하나면 thread를 늘려도 빨라질 수 없다. (결과가 같은지만 확인된다)
+	if (maxThreadCount == 1)
+		report += L"  (single hardware thread: scaling is not measurable here, run on a multi-core machine)\n";
+
+	const std::pair<int32, int32> resolutions[] = { { 1920, 1080 }, { 2560, 1440 } };
+	for (const auto& [width, height] : resolutions) {
+		// 같은 scene을 매번 그린다. (sprite는 sheet의 일부, 사이사이 debug 도형과 text)
+		std::mt19937 rng(1234);
+		DrawList drawList;
+		drawList.Begin(width, height);
+		drawList.SetLayer(LT_OBJECT, true);
+		for (int32 i = 0; i < spriteCount; ++i) {
+			const Texture& texture = *textures[rng() % textures.size()];
+			// min은 macro라 인자를 두번 계산하므로 rng()는 먼저 꺼내둔다.
+			const int32 sizeX = 48 + static_cast<int32>(rng() % 160);
+			const int32 sizeY = 48 + static_cast<int32>(rng() % 160);
+			const int32 w = min(texture.GetWidth(), sizeX);
+			const int32 h = min(texture.GetHeight(), sizeY);
+			const int32 srcX = static_cast<int32>(rng() % (texture.GetWidth() - w + 1));
+			const int32 srcY = static_cast<int32>(rng() % (texture.GetHeight() - h + 1));
+			const int32 x = static_cast<int32>(rng() % (width + w)) - w;
+			const int32 y = static_cast<int32>(rng() % (height + h)) - h;
+
+			drawList.SetDepth(static_cast<float>(y + h));
+			drawList.BlitColorKey(x, y, w, h, texture, srcX, srcY);
+			if (i % 16 == 0)
+				drawList.DrawRect(x, y, x + w, y + h, RGB(255, 0, 0));
+			if (i % 64 == 0)
+				drawList.DrawText(x, y, std::format(L"Sprite {}", i), RGB(0, 0, 0));
+		}
+		drawList.Sort();
+
+		FrameBuffer single(width, height);
+		const double singleMs = MeasureMs(iterations, [&]() {
+			single.Clear(RGB(255, 255, 255));
+			drawList.Execute(single);
+		}) / iterations;
+		report += std::format(L"  {}x{} commands: {}, single Execute : {:.3f} ms\n", width, height, drawList.GetCommands().size(), singleMs);
+
+		TileRasterizer rasterizer;
+		FrameBuffer tiled(width, height);
+		const RECT screen = { 0, 0, width, height };
+		double oneThreadMs = 0.0;
+		report += L"    threads      ms  vs single  vs 1 thread  efficiency  tiles  binned  match\n";
+		for (int32 threadCount : threadCounts) {
+			GET_SINGLE(ThreadManager)->Init(threadCount);
+
+			// 첫 실행은 worker 시작, bin 할당 비용이 섞이므로 제외
+			rasterizer.Execute(drawList, tiled, screen, RGB(255, 255, 255));
+			const double ms = MeasureMs(iterations, [&]() {
+				rasterizer.Execute(drawList, tiled, screen, RGB(255, 255, 255));
+			}) / iterations;
+
+			// thread 1개의 tiled 시간 대비 (efficiency = 1이면 thread 수만큼 빨라졌다)
+			if (threadCount == 1)
+				oneThreadMs = ms;
+			const double scaling = oneThreadMs / max(ms, 1e-6);
+
+			const bool match = ::memcmp(single.GetPixels(), tiled.GetPixels(), static_cast<size_t>(width) * height * sizeof(uint32)) == 0;
+			report += std::format(L"    {:>7}  {:>6.3f}  {:>8.2f}x  {:>10.2f}x  {:>10.2f}  {:>5}  {:>6}  {}\n",
+				threadCount, ms, singleMs / max(ms, 1e-6), scaling, scaling / threadCount,
+				rasterizer.GetStats().tiles, rasterizer.GetStats().binned, match ? L"yes" : L"NO");
+		}
+	}
+
+	GET_SINGLE(ThreadManager)->Init();
+
+	return report;
+}
+
+std::wstring RenderBenchmark::RunAlpha(int32 iterations)
+{
+	GET_SINGLE(InputManager)->Init(nullptr);
+	GET_SINGLE(AssetManager)->Init(nullptr);
+
+	World world;
+	world.Init();
+
+	const int32 width = Engine::GetScreenWidth();
+	const int32 height = Engine::GetScreenHeight();
+	std::mt19937 random(1234);
+
+	std::wstring report = std::format(L"[Alpha Blend] {}x{}, iterations: {}, SIMD: {}\n", width, height, iterations, CpuFeatures::GetSimdName(CpuFeatures::GetSimd()));
+
+	// 한 줄 kernel : 반투명, 투명, 불투명이 섞인 pixel
+	{
+		std::vector<uint32> src(static_cast<size_t>(width) * height);
+		for (uint32& pixel : src) {
+			const uint32 value = random();
+			const uint32 alpha = (value & 3) == 0 ? 0 : (value & 3) == 1 ? 255 : (value >> 24);
+			pixel = BlitUtils::Premultiply((alpha << 24) | (value & 0xFFFFFF));
+		}
+		const std::vector<uint32> background(src.size(), 0x00336699);
+
+		// CPU가 지원하는 SIMD 단계마다 scalar와 비교
+		const SimdLevel prevSimd = CpuFeatures::GetSimd();
+		const SimdLevel supported = CpuFeatures::GetSupportedSimd();
+		report += L"  kernel   opacity  scalar Mpx/s  SIMD      Mpx/s  speedup  mismatch\n";
+		for (uint32 opacity : { 255u, 128u }) {
+			std::vector<uint32> scalarResult = background;
+			const double scalarMs = MeasureMs(iterations, [&]() {
+				for (int32 y = 0; y < height; ++y)
+					BlitUtils::BlendRowScalar(&scalarResult[static_cast<size_t>(y) * width], &src[static_cast<size_t>(y) * width], width, opacity, 0);
+			});
+
+			for (SimdLevel level : { SimdLevel::SL_Sse, SimdLevel::SL_Avx2 }) {
+				if (level > supported)
+					break;
+
+				CpuFeatures::SetSimd(level);
+				std::vector<uint32> simdResult = background;
+				const double simdMs = MeasureMs(iterations, [&]() {
+					for (int32 y = 0; y < height; ++y)
+						BlitUtils::BlendRow(&simdResult[static_cast<size_t>(y) * width], &src[static_cast<size_t>(y) * width], width, opacity, 0);
+				});
+
+				int64 mismatch = 0;
+				for (size_t i = 0; i < src.size(); ++i)
+					mismatch += scalarResult[i] != simdResult[i];
+
+				const double pixels = static_cast<double>(src.size()) * iterations;
+				report += std::format(L"  row      {:>7}  {:>12.1f}  {:<4} {:>10.1f}  {:>6.2f}x  {}\n",
+					opacity, pixels / (scalarMs * 1000.0), CpuFeatures::GetSimdName(level), pixels / (simdMs * 1000.0), scalarMs / max(simdMs, 1e-6), mismatch);
+			}
+			CpuFeatures::SetSimd(prevSimd);
+		}
+	}
+
+	// PNG는 Load에 실패하면 (WIC 없음) 빠진다.
+	GET_SINGLE(AssetManager)->LoadTexture(L"Tiles_png", L"Sprite\\Tiles.png");
+	GET_SINGLE(AssetManager)->LoadTexture(L"pngegg_png", L"Sprite\\pngegg.png");
+
+	std::map<std::wstring, std::shared_ptr<Texture>> textures(GET_SINGLE(AssetManager)->GetTextures().begin(), GET_SINGLE(AssetManager)->GetTextures().end());
+
+	// 화면 크기 안에서 sheet 전체를 그린다. (항상 섞기 vs 복사할 수 있으면 복사)
+	static const wchar_t* ALPHA_NAMES[] = { L"color-key", L"opaque", L"binary", L"blend" };
+	report += L"  sheet          size       alpha      blend ms  BlitAlpha ms  speedup  opacity 128 ms  mismatch\n";
+	const uint32 background = BlitUtils::ToPixel(RGB(30, 60, 90));
+	std::vector<uint32> blendResult(static_cast<size_t>(width) * height);
+	FrameBuffer fastResult(width, height);
+	for (const auto& [name, texture] : textures) {
+		const Texture& sheet = *texture;
+		const int32 w = min(width, sheet.GetWidth());
+		const int32 h = min(height, sheet.GetHeight());
+
+		std::fill(blendResult.begin(), blendResult.end(), background);
+		fastResult.Clear(RGB(30, 60, 90));
+		const double blendMs = MeasureMs(iterations, [&]() {
+			BlitUtils::BlitBlend(blendResult.data(), width, height, 0, 0, sheet.GetPixels(), sheet.GetWidth(), sheet.GetHeight(), 0, 0, w, h,
+				sheet.GetSpans(), 255, sheet.HasAlpha() ? 0 : 0xFF000000);
+		}) / iterations;
+		const double fastMs = MeasureMs(iterations, [&]() {
+			fastResult.BlitAlpha(0, 0, w, h, sheet, 0, 0, 255);
+		}) / iterations;
+
+		// 복사는 alpha byte를 그대로 두므로 RGB만 비교
+		int64 mismatch = 0;
+		for (size_t i = 0; i < blendResult.size(); ++i)
+			mismatch += ((blendResult[i] ^ fastResult.GetPixels()[i]) & 0x00FFFFFF) != 0;
+
+		const double halfMs = MeasureMs(iterations, [&]() {
+			fastResult.BlitAlpha(0, 0, w, h, sheet, 0, 0, 128);
+		}) / iterations;
+
+		report += std::format(L"  {:<14} {:>4}x{:<4}  {:<9}  {:>8.3f}  {:>12.3f}  {:>6.2f}x  {:>14.3f}  {}\n",
+			name, sheet.GetWidth(), sheet.GetHeight(), ALPHA_NAMES[static_cast<int32>(sheet.GetAlpha())],
+			blendMs, fastMs, blendMs / max(fastMs, 1e-6), halfMs, mismatch);
+	}
+
+	return report;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+/*
+	창 없이 실행하는 렌더링 benchmark
+		- Benchmark.exe render blit spans dirty tiles alpha
+		- Client.exe -benchmark render
+		- 명령줄은 CollisionBenchmark::Run이 받아서 넘겨준다.
+		- 결과는 CollisionBenchmark::Run과 같이 표준 출력, Benchmark.txt에 남긴다.
+*/
+struct RenderBenchmark
+{
+	// args(CollisionBenchmark::SplitArgs) 중 렌더링 benchmark 이름을 골라 실행, 아무것도 없으면 빈 문자열
+	static std::wstring Run(const std::vector<std::wstring>& args);
+	static const wchar_t* GetModes() { return L"render blit spans dirty tiles alpha"; }
+
+	// GameLevel을 CPU FrameBuffer에 그리면서 Tick, Render 시간을 측정 (마지막 frame은 RenderBenchmark.bmp)
+	static std::wstring RunFrames(int32 frames = 300);
+
+	// color-key blit 처리량 (Mpixel/s), 단순 loop와 BlitUtils의 scalar, SIMD(CPU가 지원하는 단계마다) 비교
+	static std::wstring RunBlit(int32 blitCount = 2000, int32 iterations = 20);
+
+	// GameLevel이 Load하는 sprite sheet마다 ColorKeySpans 메모리와 sheet 전체를 그리는 시간 (key 비교 vs 구간 복사)
+	static std::wstring RunSpans(int32 iterations = 50);
+
+	// 매 frame 전체를 다시 그리는 것과 DirtyRectRenderer (바뀐 영역만) 비교 (다시 그린 면적, 시간, 결과가 같은지)
+	static std::wstring RunDirty(int32 frames = 300);
+
+	// 1080p, 1440p 화면에 sprite를 흩어놓고 한 thread의 DrawList::Execute와 TileRasterizer(thread 수를 바꿔가며) 비교
+	// (thread 수마다 시간, single Execute와 thread 1개 대비 속도, 결과가 같은지)
+	static std::wstring RunTiles(int32 spriteCount = 4000, int32 iterations = 20);
+
+	/*
+		premultiplied alpha blend
+			- BlendRow의 scalar, SIMD 처리량 (Mpixel/s)
+			- Resources/Sprite의 PNG와 GameLevel의 sprite sheet를 항상 섞는 경우(BlitBlend)와 FrameBuffer::BlitAlpha(불투명, key만 있으면 복사) 비교
+	*/
+	static std::wstring RunAlpha(int32 iterations = 50);
+};
+
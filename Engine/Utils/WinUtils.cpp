@@ -1,23 +1,23 @@
 #include "pch.h"
 #include "WinUtils.h"
+#include "Render\RenderTarget.h"
 
-void WinUtils::DrawText(HDC hdc, const Vector2D& pos, const std::wstring& str)
+void WinUtils::DrawText(RenderTarget& target, const Vector2D& pos, const std::wstring& str, uint32 color)
 {
-	::TextOut(hdc, static_cast<int32>(pos.X), static_cast<int32>(pos.Y), str.c_str(), static_cast<int32>(str.size()));
+	target.DrawText(static_cast<int32>(pos.X), static_cast<int32>(pos.Y), str, color);
 }
 
-void WinUtils::DrawRect(HDC hdc, const Vector2D& pos, const int32& w, const int32& h)
+void WinUtils::DrawRect(RenderTarget& target, const Vector2D& pos, const int32& w, const int32& h, uint32 color)
 {
-	::Rectangle(hdc, static_cast<int32>(pos.X - w / 2), static_cast<int32>(pos.Y - h / 2), static_cast<int32>(pos.X + w / 2), static_cast<int32>(pos.Y + h / 2));
+	target.DrawRect(static_cast<int32>(pos.X - w / 2), static_cast<int32>(pos.Y - h / 2), static_cast<int32>(pos.X + w / 2), static_cast<int32>(pos.Y + h / 2), color);
 }
 
-void WinUtils::DrawCircle(HDC hdc, const Vector2D& pos, const int32& radius)
+void WinUtils::DrawCircle(RenderTarget& target, const Vector2D& pos, const int32& radius, uint32 color)
 {
-	::Ellipse(hdc, static_cast<int32>(pos.X - radius), static_cast<int32>(pos.Y - radius), static_cast<int32>(pos.X + radius), static_cast<int32>(pos.Y + radius));
+	target.DrawCircle(static_cast<int32>(pos.X), static_cast<int32>(pos.Y), radius, color);
 }
 
-void WinUtils::DrawLine(HDC hdc, const Vector2D& from, const Vector2D& to)
+void WinUtils::DrawLine(RenderTarget& target, const Vector2D& from, const Vector2D& to, uint32 color)
 {
-	::MoveToEx(hdc, static_cast<int32>(from.X), static_cast<int32>(from.Y), nullptr);
-	::LineTo(hdc, static_cast<int32>(to.X), static_cast<int32>(to.Y));
+	target.DrawLine(static_cast<int32>(from.X), static_cast<int32>(from.Y), static_cast<int32>(to.X), static_cast<int32>(to.Y), color);
 }
\ No newline at end of file
@@ -1,11 +1,13 @@
 #pragma once
 
+class RenderTarget;
+
 class WinUtils
 {
 public:
-	static void DrawText(HDC hdc, const Vector2D& pos, const std::wstring& str);
-	static void DrawRect(HDC hdc, const Vector2D& pos, const int32& w, const int32& h);
-	static void DrawCircle(HDC hdc, const Vector2D& pos, const int32& radius);
-	static void DrawLine(HDC hdc, const Vector2D& from, const Vector2D& to);
+	static void DrawText(RenderTarget& target, const Vector2D& pos, const std::wstring& str, uint32 color = RGB(0, 0, 0));
+	static void DrawRect(RenderTarget& target, const Vector2D& pos, const int32& w, const int32& h, uint32 color = RGB(0, 0, 0));
+	static void DrawCircle(RenderTarget& target, const Vector2D& pos, const int32& radius, uint32 color = RGB(0, 0, 0));
+	static void DrawLine(RenderTarget& target, const Vector2D& from, const Vector2D& to, uint32 color = RGB(0, 0, 0));
 };
 
@@ -4,6 +4,7 @@
 #include "Manager\AssetManager.h"
 #include "Engine.h"
 #include "Utils\WinUtils.h"
+#include "Render\DrawList.h"
 
 EditLevel::EditLevel()
 {
@@ -24,7 +25,7 @@ void EditLevel::Tick(float DeltaTime)
 	if (GET_SINGLE(InputManager)->GetEventDown(KeyType::LeftMouse))
 		DrawLine();
 
-	// ׸ ̾ ׸
+	// 그만 이어서 그리기
 	if (GET_SINGLE(InputManager)->GetEventDown(KeyType::RightMouse))
 		StopDraw();
 
@@ -41,13 +42,13 @@ void EditLevel::Tick(float DeltaTime)
 		LoadDrawing(L"Draw.txt");
 }
 
-void EditLevel::Render(HDC hdc)
+void EditLevel::Render(DrawList& drawList)
 {
 	for (auto& [from, to] : _lines) {
 		Vector2D p1 = from;
 		Vector2D p2 = to;
 
-		WinUtils::DrawLine(hdc, p1, p2);
+		WinUtils::DrawLine(drawList, p1, p2);
 	}
 }
 
@@ -55,11 +56,11 @@ void EditLevel::DrawLine()
 {
 	POINT mousePos = GET_SINGLE(InputManager)->GetMousePos();
 
-	if (_setOrigin) { //  ġ
+	if (_setOrigin) { // 시작 위치
 		_lastPos = mousePos;
 		_setOrigin = false;
 	}
-	else { //  ġ
+	else { // 다음 위치
 		_lines.push_back({ _lastPos, mousePos });
 		_lastPos = mousePos;
 	}
@@ -75,17 +76,17 @@ bool EditLevel::SaveDrawing(const std::wstring& file)
 	std::wofstream ofs;
 
 	std::filesystem::path path = _resourcePath / file;
-	ofs.open(path, std::ios::out); //   
+	ofs.open(path, std::ios::out); // 내용이 있으면 지운다
 	if (!ofs.is_open())
 		return false;
 
-	// ׸ Local Space (߾) ϱ  ׸ object ߾ ã
+	// 그린걸 Local Space의 원점(중앙)에 저장하기 위해 그린 object의 중앙점을 찾기
 	int32 minX = INT32_MAX;
 	int32 minY = INT32_MAX;
 	int32 maxX = INT32_MIN;
 	int32 maxY = INT32_MIN;
 
-	//  ׷ ǥ min, max ã
+	// 현재 그려진 좌표중 min, max를 찾기
 	for (auto& [from, to] : _lines) {
 		minX = min(min(minX, from.x), to.x);
 		minY = min(min(minY, from.y), to.y);
@@ -93,11 +94,11 @@ bool EditLevel::SaveDrawing(const std::wstring& file)
 		maxY = max(max(maxY, from.y), to.y);
 	}
 
-	// minX + maxXҶ Ȥ int32  
+	// minX + maxX할때 혹시 int32 범위를 벗어날까봐
 	int32 midX = minX + static_cast<int>((maxX - minX) * 0.5f); 
 	int32 midY = minY + static_cast<int>((maxY - minY) * 0.5f);
 
-	// Line 
+	// Line의 개수
 	ofs << static_cast<int32>(_lines.size()) << std::endl;
 
 	for (auto& line : _lines) {
@@ -128,11 +129,11 @@ bool EditLevel::LoadDrawing(const std::wstring& file)
 
 	Clear();
 
-	//  
+	// 라인 개수
 	int32 count;
 	ifs >> count;
 
-	// ȭ ߾
+	// 화면의 정중앙
 	int32 midX = static_cast<int>(Engine::GetScreenWidth() * 0.5f);
 	int32 midY = static_cast<int>(Engine::GetScreenHeight() * 0.5f);
 
@@ -144,7 +145,7 @@ bool EditLevel::LoadDrawing(const std::wstring& file)
 		ifs >> str;
 		::swscanf_s(str.c_str(), L"(%d,%d)->(%d,%d)", &pt1.x, &pt1.y, &pt2.x, &pt2.y);
 
-		// ȭ ߾ӿ ׷ֱ
+		// 화면 중앙에 그려주기
 		pt1.x += midX;
 		pt1.y += midY;
 		pt2.x += midX;
@@ -7,7 +7,7 @@ public:
 
 	virtual void Init() override;
 	virtual void Tick(float DeltaTime) override;
-	virtual void Render(HDC hdc) override;
+	virtual void Render(DrawList& drawList) override;
 
 private:
 	void DrawLine();
@@ -17,7 +17,7 @@ private:
 	void Undo();
 	void Clear();
 private:
-	// TODO: Line ƴ϶ Mesh Class  ļ , ڽ µ ׸  ֵ
+	// TODO: Line이 아니라 Mesh Class를 따로 파서 원, 박스같은 형태도 그릴 수 있도록
 	std::vector<std::pair<POINT, POINT>> _lines;
 
 	fs::path _resourcePath;
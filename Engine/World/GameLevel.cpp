@@ -55,8 +55,8 @@ void GameLevel::Tick(float DeltaTime)
 	Super::Tick(DeltaTime);
 }
 
-void GameLevel::Render(HDC hdc)
+void GameLevel::Render(DrawList& drawList)
 {
-	Super::Render(hdc);
+	Super::Render(drawList);
 
 }
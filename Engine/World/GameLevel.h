@@ -8,7 +8,7 @@ public:
 
 	virtual void Init() override;
 	virtual void Tick(float DeltaTime) override;
-	virtual void Render(HDC hdc) override;
+	virtual void Render(DrawList& drawList) override;
 
 };
 
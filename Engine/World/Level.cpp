@@ -4,6 +4,21 @@
 #include "Manager\CollisionManager.h"
 #include "Actor\TilemapActor.h"
 #include "Resources\Tilemap.h"
+#include "Render\DrawList.h"
+#include "Render\CullGrid.h"
+#include "Engine.h"
+#include "World\World.h"
+
+namespace {
+	// Layer의 Actor가 이만큼 되면 CullGrid를 만들고, 절반 아래로 줄면 없앤다. (자주 바뀌지 않도록)
+	constexpr int32 CULL_GRID_MIN_ACTORS = 64;
+
+	bool IsVisible(const RECT& bounds, const RECT& view)
+	{
+		return bounds.left < view.right && view.left < bounds.right && bounds.top < view.bottom && view.top < bounds.bottom;
+	}
+}
+
 Level::Level()
 {
 }
@@ -31,13 +46,92 @@ void Level::Tick(float DeltaTime)
 	}
 }
 
-void Level::Render(HDC hdc)
+void Level::Render(DrawList& drawList)
 {
-	for (auto& actors : _actors) {
-		for (std::shared_ptr<Actor> actor : actors) {
-			if (actor)
-				actor->Render(hdc);
+	_renderStats = {};
+
+	// 카메라가 보는 World 영역 (Actor들이 화면 좌표로 바꿀때와 같은 기준)
+	const Vector2D viewPos = MathUtils::floor(World::GetCameraPos() - Engine::GetScreenSize() * 0.5f);
+	const RECT view = {
+		static_cast<LONG>(viewPos.X),
+		static_cast<LONG>(viewPos.Y),
+		static_cast<LONG>(viewPos.X) + drawList.GetWidth(),
+		static_cast<LONG>(viewPos.Y) + drawList.GetHeight()
+	};
+
+	for (int32 layer = 0; layer < LT_MAXCOUNT; ++layer) {
+		// Object끼리만 Y로 앞뒤를 정한다.
+		drawList.SetLayer(layer, layer == LT_OBJECT);
+
+		std::vector<std::shared_ptr<Actor>>& actors = _actors[layer];
+		std::vector<RenderEntry>& entries = _renderEntries[layer];
+		UpdateRenderEntries(layer);
+
+		auto renderActor = [&](int32 index) {
+			const std::shared_ptr<Actor>& actor = actors[index];
+			if (actor == nullptr)
+				return;
+
+			drawList.SetDepth(actor->GetPos().Y);
+			actor->Render(drawList);
+			++_renderStats.rendered;
+		};
+
+		if (_cullGrids[layer]) {
+			// 찾은 id는 정렬되어 있으므로 AddActor 순서 그대로 그린다.
+			_cullGrids[layer]->Query(view, _visibleIds);
+			auto it = entries.begin();
+			for (uint32 id : _visibleIds) {
+				it = std::lower_bound(it, entries.end(), id, [](const RenderEntry& entry, uint32 id) { return entry.id < id; });
+				if (it == entries.end())
+					break;
+				if (it->id == id)
+					renderActor(static_cast<int32>(it - entries.begin()));
+			}
+			++_renderStats.gridLayers;
 		}
+		else {
+			for (int32 i = 0; i < static_cast<int32>(actors.size()); ++i) {
+				if (entries[i].culling && IsVisible(entries[i].bounds, view) == false)
+					continue;
+				renderActor(i);
+			}
+		}
+
+		_renderStats.actors += static_cast<int32>(actors.size());
+	}
+
+	_renderStats.culled = _renderStats.actors - _renderStats.rendered;
+}
+
+void Level::UpdateRenderEntries(int32 layer)
+{
+	std::vector<std::shared_ptr<Actor>>& actors = _actors[layer];
+	std::vector<RenderEntry>& entries = _renderEntries[layer];
+	std::unique_ptr<CullGrid>& grid = _cullGrids[layer];
+
+	const int32 count = static_cast<int32>(actors.size());
+	if (grid == nullptr && count >= CULL_GRID_MIN_ACTORS) {
+		grid = std::make_unique<CullGrid>();
+		// 처음 만들었으면 모두 넣는다.
+		for (RenderEntry& entry : entries)
+			entry.version = 0;
+	}
+	else if (grid && count < CULL_GRID_MIN_ACTORS / 2) {
+		grid.reset();
+	}
+
+	for (int32 i = 0; i < count; ++i) {
+		RenderEntry& entry = entries[i];
+		const std::shared_ptr<Actor>& actor = actors[i];
+		if (actor == nullptr || entry.version == actor->GetRenderVersion())
+			continue;
+
+		entry.version = actor->GetRenderVersion();
+		entry.culling = actor->GetRenderBounds(entry.bounds);
+
+		if (grid)
+			grid->Update(entry.id, entry.culling ? &entry.bounds : nullptr);
 	}
 }
 
@@ -46,8 +140,13 @@ void Level::AddActor(std::shared_ptr<Actor> actor)
 	if (actor == nullptr)
 		return;
 
-	std::vector<std::shared_ptr<Actor>>& v = _actors[actor->GetLayer()];
-	v.push_back(actor);
+	const int32 layer = actor->GetLayer();
+	_actors[layer].push_back(actor);
+
+	// bounds는 다음 Render에서 구한다. (version = 0)
+	RenderEntry entry;
+	entry.id = _nextRenderId++;
+	_renderEntries[layer].push_back(entry);
 }
 
 void Level::RemoveActor(std::weak_ptr<Actor> actor)
@@ -56,8 +155,21 @@ void Level::RemoveActor(std::weak_ptr<Actor> actor)
 	if (cachedActor == nullptr)
 		return;
 
-	std::vector<std::shared_ptr<Actor>>& v = _actors[cachedActor->GetLayer()];
-	v.erase(std::remove(v.begin(), v.end(), cachedActor), v.end());
+	const int32 layer = cachedActor->GetLayer();
+	std::vector<std::shared_ptr<Actor>>& v = _actors[layer];
+	std::vector<RenderEntry>& entries = _renderEntries[layer];
+
+	// 그리는 순서가 바뀌지 않도록 RenderEntry도 같은 자리를 지운다.
+	for (int32 i = static_cast<int32>(v.size()) - 1; i >= 0; --i) {
+		if (v[i] != cachedActor)
+			continue;
+
+		if (_cullGrids[layer])
+			_cullGrids[layer]->Remove(entries[i].id);
+
+		v.erase(v.begin() + i);
+		entries.erase(entries.begin() + i);
+	}
 }
 
 int32 Level::GetActorCount()
@@ -4,6 +4,16 @@ class Actor;
 class CollisionManager;
 class TilemapActor;
 class Tilemap;
+class DrawList;
+class CullGrid;
+
+// 마지막 Render의 culling 결과
+struct LevelRenderStats {
+	int32 actors = 0;
+	int32 rendered = 0;
+	int32 culled = 0;		// 카메라 밖이라 Render를 호출하지 않은 Actor 수
+	int32 gridLayers = 0;	// CullGrid로 찾은 Layer 수
+};
 
 class Level
 {
@@ -13,12 +23,14 @@ public:
 
 	virtual void Init();
 	virtual void Tick(float DeltaTime);
-	virtual void Render(HDC hdc);
+	// Actor의 Render는 drawList에 명령만 쌓는다. (Layer, depth는 여기서 정한다)
+	virtual void Render(DrawList& drawList);
 
 	virtual void AddActor(std::shared_ptr<Actor> actor);
 	virtual void RemoveActor(std::weak_ptr<Actor> actor);
 
 	int32 GetActorCount();
+	const LevelRenderStats& GetRenderStats() const { return _renderStats; }
 
 	std::shared_ptr<Actor> FindClosestTarget(Vector2D pos);
 
@@ -30,13 +42,28 @@ public:
 	static std::shared_ptr<Tilemap> GetCurTilemap();
 
 private:
-	// TODO: Actor  unordered_map ϴ°  ?, levelٴ world ϴ° Ͱ.
-	// TODO: Level  ̹Ƿ level  Actor  ϴ°  .
-	// (, World  actor level  actor °?)
-	// Layer   Rendering (ex: background -> object, ̷ object background δ)
-	std::vector<std::shared_ptr<Actor>> _actors[LT_MAXCOUNT]; //  2D ̶ ̷  , 3D Depth Ȯ
+	// TODO: Actor 관리는 unordered_map으로 하는게 더 좋을수도?, level보다는 world에서 관리하는게 맞을것같다.
+	// TODO: Level은 일종의 맵이므로 level에 속한 Actor를 따로 관리하는게 좋을것 같다.
+	// (즉, World에 속한 actor와 level에 속한 actor로 나누는것?)
+	// Layer별로 저장해 순서대로 Rendering (ex: background -> object, 이래야 object가 background위에 보인다)
+	std::vector<std::shared_ptr<Actor>> _actors[LT_MAXCOUNT]; // 현재 2D 엔진이라 이렇게 한 것, 3D면 Depth값으로 확인
+
+	// Camera culling : _actors와 같은 순서로 Actor마다 하나씩 (id는 AddActor 순서라 정렬된 상태)
+	struct RenderEntry {
+		uint32 id = 0;
+		uint32 version = 0;		// bounds를 구한 Actor::GetRenderVersion
+		RECT bounds = {};
+		bool culling = false;	// false = 영역을 모르므로 항상 그린다.
+	};
+	void UpdateRenderEntries(int32 layer);
+	std::vector<RenderEntry> _renderEntries[LT_MAXCOUNT];
+	// Actor가 많은 Layer만 사용 (적으면 하나씩 검사하는게 더 빠르다)
+	std::unique_ptr<CullGrid> _cullGrids[LT_MAXCOUNT];
+	std::vector<uint32> _visibleIds;
+	uint32 _nextRenderId = 1;
+	LevelRenderStats _renderStats;
 
-	// TODO: Level staticٴ UEó GetWorld ޾ƿµ Level  ϴ°  ʹ.
+	// TODO: Level에서 static보다는 UE처럼 GetWorld로 받아온뒤 Level에 접근해 사용하는게 더 좋을듯싶다.
 	static inline std::shared_ptr<TilemapActor> _curTilemapActor = nullptr;;
 };
 
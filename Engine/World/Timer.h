@@ -9,7 +9,7 @@ public:
 	bool TimerTick(float deltaTime);
 
 public:
-	// Լ  + Լ ü    ִ. (return type = void, parameter = void)
+	// 함수 포인터 + 함수 객체 모두 받을 수 있다. (return type = void, parameter = void)
 	std::function<void(void)> _execute = nullptr;
 private:
 	float _wait;
@@ -5,6 +5,10 @@
 #include "Manager\InputManager.h"
 #include "Manager\LevelManager.h"
 #include "Manager\CollisionManager.h"
+#include "Manager\ThreadManager.h"
+#include "Render\DrawList.h"
+#include "World\Level.h"
+#include "Render\DebugDraw.h"
 
 
 World::World()
@@ -15,6 +19,7 @@ World::World()
 
 World::~World()
 {
+	GET_SINGLE(ThreadManager)->Clear();
 }
 
 void World::Init()
@@ -24,6 +29,7 @@ void World::Init()
 	_levelManager->ChangeLevel(LevelType::LEVEL_GAME);
 	SetCurrentLevel(_levelManager->GetCurrentLevel());
 
+	GET_SINGLE(ThreadManager)->Init();
 	GET_SINGLE(CollisionManager)->Init();
 }
 
@@ -37,27 +43,51 @@ void World::Tick()
 
 	_levelManager->Tick(deltaTime);
 
+#if USE_DEBUG_DRAW
+	// F1 = Collider 도형, F2 = 정보 text
+	if (GET_SINGLE(InputManager)->GetEventDown(KeyType::F1))
+		GET_SINGLE(DebugDraw)->Toggle(DDC_Collider);
+	if (GET_SINGLE(InputManager)->GetEventDown(KeyType::F2))
+		GET_SINGLE(DebugDraw)->Toggle(DDC_Stats);
+#endif
 }
 
-void World::Render(HDC hdc)
+void World::Render(DrawList& drawList)
 {
-	_levelManager->Render(hdc);
+	_levelManager->Render(drawList);
 
-	// Option
-	{
-		uint32 now = static_cast<uint32>(::GetTickCount64());
+	// Option (DebugDraw를 뺀 빌드에서는 문자열도 만들지 않는다)
+	if (DEBUG_DRAW_ENABLED(DDC_Stats)) {
 		{
 			auto [mousePosX, mousePosY] = GET_SINGLE(InputManager)->GetMousePos();
 			std::wstring str = std::format(L"Mouse({0}, {1})", mousePosX, mousePosY);
-			::TextOut(hdc, 20, 10, str.c_str(), static_cast<int32>(str.size())); uint64 prevTick = 0;
+			DEBUG_DRAW_TEXT(DDC_Stats, 20, 10, std::move(str), RGB(0, 0, 0));
 		}
 
 		{
 			int width = Engine::GetScreenWidth();
 
 			std::wstring str = std::format(L"FPS({0}))", _timeManager->GetFPS());
-			::TextOut(hdc, width - 90, 10, str.c_str(), static_cast<int32>(str.size()));
+			DEBUG_DRAW_TEXT(DDC_Stats, width - 90, 10, std::move(str), RGB(0, 0, 0));
 
 		}
+
+		{
+			// Broadphase 효율 확인용 (Collider 수 대비 검사한 pair 수)
+			const CollisionStats& stats = GET_SINGLE(CollisionManager)->GetStats();
+			std::wstring str = std::format(L"Collision({0}, Resting: {1}, Pairs: {2}, Hits: {3}, Events: {4})", stats.colliderCount, stats.resting, stats.pairsTested, stats.pairsHit, stats.events);
+			DEBUG_DRAW_TEXT(DDC_Stats, 20, 30, std::move(str), RGB(0, 0, 0));
+		}
+
+		if (std::shared_ptr<Level> level = GetCurrentLevel()) {
+			// Camera culling 확인용 (카메라 밖이라 그리지 않은 Actor 수)
+			const LevelRenderStats& stats = level->GetRenderStats();
+			std::wstring str = std::format(L"Render(Actors: {0}, Rendered: {1}, Culled: {2}, Grid layers: {3})", stats.actors, stats.rendered, stats.culled, stats.gridLayers);
+			DEBUG_DRAW_TEXT(DDC_Stats, 20, 50, std::move(str), RGB(0, 0, 0));
+		}
 	}
+
+	// Level, 정보 text에서 모은 debug 도형을 한번에 그린다. (모든 Layer 위에 넣은 순서대로)
+	drawList.SetLayer(LT_MAXCOUNT, false);
+	DEBUG_DRAW_FLUSH(drawList);
 }